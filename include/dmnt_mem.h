@@ -1,10 +1,14 @@
 #pragma once
 
+#include "memory_source.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+
 #ifdef __SWITCH__
 #include <switch.h>
 #include <switch/dmntcht.h>
-#include <cstdint>
-#include <cstdio>
+#endif
 
 // Pointer chains from Tera-Finder DataBlocks.cs (SV 3.0.1)
 namespace DmntPointers {
@@ -21,16 +25,107 @@ namespace DmntPointers {
     constexpr size_t   KMyStatusSize = 0x68;
 }
 
+#ifdef __SWITCH__
+// MemorySource backed by dmnt:cht, attached to the running game.
+class DmntchtSource final : public MemorySource {
+public:
+    DmntCheatProcessMetadata meta = {};
+
+    uint64_t titleId() const override { return meta.title_id; }
+    uint64_t mainBase() const override { return meta.main_nso_extents.base; }
+    uint64_t heapBase() const override { return meta.heap_extents.base; }
+    bool read(uint64_t addr, void* buf, size_t size) override {
+        return R_SUCCEEDED(dmntchtReadCheatProcessMemory(addr, buf, size));
+    }
+    bool write(uint64_t addr, const void* buf, size_t size) override {
+        return R_SUCCEEDED(dmntchtWriteCheatProcessMemory(addr, buf, size));
+    }
+};
+#endif
+
 namespace DmntMem {
 
-inline DmntCheatProcessMetadata g_meta = {};
-inline bool g_initialized = false;
+// Active memory source; null until init() succeeds or setSource() is called.
+inline MemorySource* g_source = nullptr;
+inline bool g_initialized = false;  // dmnt:cht service is up
+
+#ifdef __SWITCH__
+inline DmntchtSource g_dmnt;
+#endif
+
+// --- Resolved-prefix cache ---
+//
+// Chains often share a prefix (both SV raid blocks start [[main+47350D8]+1C0]+88,
+// PLA's spawner and outbreak reads all start [main+42A6EE0]+330). While a
+// Session is open, every prefix a chain walk resolves is remembered, and later
+// walks resume from the longest cached prefix instead of re-reading each hop.
+// Outside a session nothing is cached, so a lone write (e.g. teleport) always
+// walks the live pointers. Opening the outermost session or calling
+// invalidate() bumps the generation, which drops every cached prefix.
+// Not thread-safe: memory reads are expected to happen on one thread.
+
+constexpr int PREFIX_CACHE_SIZE = 16;
+constexpr int PREFIX_MAX_LEN    = 8;
+
+struct PrefixEntry {
+    uint64_t chain[PREFIX_MAX_LEN];
+    int      len;          // number of chain elements covered
+    uint64_t addr;         // address after applying chain[0..len-1]
+    uint32_t generation;   // valid only while == g_generation
+};
+
+inline PrefixEntry g_prefixCache[PREFIX_CACHE_SIZE] = {};
+inline int         g_prefixNext = 0;
+inline uint32_t    g_generation = 1;
+inline int         g_sessionDepth = 0;
+
+inline void invalidate() {
+    g_generation++;
+}
+
+// RAII read session: `DmntMem::Session session;` at the top of a scan.
+// Sessions nest; only the outermost one starts a fresh generation.
+struct Session {
+    Session() { if (g_sessionDepth++ == 0) invalidate(); }
+    ~Session() { g_sessionDepth--; }
+    Session(const Session&) = delete;
+    Session& operator=(const Session&) = delete;
+};
+
+inline bool prefixLookup(const uint64_t* chain, int len, uint64_t& addr) {
+    for (const auto& e : g_prefixCache) {
+        if (e.generation != g_generation || e.len != len) continue;
+        bool match = true;
+        for (int i = 0; i < len && match; i++) match = e.chain[i] == chain[i];
+        if (match) { addr = e.addr; return true; }
+    }
+    return false;
+}
+
+inline void prefixStore(const uint64_t* chain, int len, uint64_t addr) {
+    if (len > PREFIX_MAX_LEN) return;
+    PrefixEntry& e = g_prefixCache[g_prefixNext];
+    g_prefixNext = (g_prefixNext + 1) % PREFIX_CACHE_SIZE;
+    for (int i = 0; i < len; i++) e.chain[i] = chain[i];
+    e.len = len;
+    e.addr = addr;
+    e.generation = g_generation;
+}
+
+// Route all reads/writes through `src` (e.g. a FileMemorySource holding a
+// recorded image). Pass nullptr to detach.
+inline void setSource(MemorySource* src) {
+    g_source = src;
+    invalidate();
+}
 
 // Idempotent: safe to call multiple times. The IPC service is initialized
 // exactly once; subsequent calls only re-verify that we're still attached to
 // a cheat process. This prevents handle leaks from repeated scans (e.g. the
 // overlay's Y-rescan button firing many times in a session).
+// Off-Switch there is no service; init() just reports whether a source was set.
 inline bool init() {
+#ifdef __SWITCH__
     if (!g_initialized) {
         if (R_FAILED(dmntchtInitialize())) return false;
         g_initialized = true;
@@ -42,67 +137,86 @@ inline bool init() {
         if (R_FAILED(dmntchtForceOpenCheatProcess())) return false;
     }
 
-    return R_SUCCEEDED(dmntchtGetCheatProcessMetadata(&g_meta));
+    if (R_FAILED(dmntchtGetCheatProcessMetadata(&g_dmnt.meta))) return false;
+    if (!g_source) setSource(&g_dmnt);
+    return true;
+#else
+    return g_source != nullptr;
+#endif
 }
 
+// Detaches whatever source is installed: a wrapper such as RecordingSource
+// reads through g_dmnt and must not outlive the service.
 inline void exit() {
+#ifdef __SWITCH__
+    setSource(nullptr);
     if (g_initialized) {
         dmntchtExit();
         g_initialized = false;
     }
+#endif
 }
 
 inline uint64_t titleId() {
-    return g_meta.title_id;
+    return g_source ? g_source->titleId() : 0;
 }
 
-// Resolve a pointer chain and read a block of memory.
-// chain[0] is the offset from main NSO base.
-// chain[1..n-1] are dereference offsets.
-inline bool readBlock(const uint64_t* chain, int chainLen, uint8_t* buf, size_t size) {
-    if (!g_initialized || chainLen < 1) return false;
+// Resolve a pointer chain to the address readBlock() would read from, without
+// reading the target. Lets callers walk the chain once and then issue several
+// large reads relative to the result.
+inline bool resolveChain(const uint64_t* chain, int chainLen, uint64_t& out) {
+    if (!g_source || chainLen < 1) return false;
+
+    uint64_t addr = g_source->mainBase() + chain[0];
+    int start = 1;
 
-    uint64_t addr = g_meta.main_nso_extents.base + chain[0];
+    // Resume from the longest prefix resolved earlier in this session.
+    if (g_sessionDepth > 0) {
+        for (int k = std::min(chainLen, PREFIX_MAX_LEN); k >= 2; k--) {
+            if (prefixLookup(chain, k, addr)) { start = k; break; }
+        }
+    }
 
-    for (int i = 1; i < chainLen; i++) {
+    for (int i = start; i < chainLen; i++) {
         uint64_t ptr = 0;
-        Result rc = dmntchtReadCheatProcessMemory(addr, &ptr, sizeof(uint64_t));
-        if (R_FAILED(rc) || ptr == 0) return false;
+        if (!g_source->read(addr, &ptr, sizeof(uint64_t)) || ptr == 0) return false;
         addr = ptr + chain[i];
+        if (g_sessionDepth > 0) prefixStore(chain, i + 1, addr);
     }
+    out = addr;
+    return true;
+}
+
+// Read from an absolute address (e.g. one returned by resolveChain()).
+inline bool readAbsolute(uint64_t addr, uint8_t* buf, size_t size) {
+    return g_source && g_source->read(addr, buf, size);
+}
+
+// Resolve a pointer chain and read a block of memory.
+// chain[0] is the offset from main NSO base.
+// chain[1..n-1] are dereference offsets.
+inline bool readBlock(const uint64_t* chain, int chainLen, uint8_t* buf, size_t size) {
+    uint64_t addr = 0;
+    if (!resolveChain(chain, chainLen, addr)) return false;
 
-    Result rc = dmntchtReadCheatProcessMemory(addr, buf, size);
-    return R_SUCCEEDED(rc);
+    return g_source->read(addr, buf, size);
 }
 
 // Read a block directly from the game heap at a fixed offset.
 // Used by SwSh den crawler (dens are at heap base + offset, not pointer chains).
 inline bool readHeap(uint64_t heapOffset, uint8_t* buf, size_t size) {
-    if (!g_initialized) return false;
+    if (!g_source) return false;
 
-    uint64_t addr = g_meta.heap_extents.base + heapOffset;
-    Result rc = dmntchtReadCheatProcessMemory(addr, buf, size);
-    return R_SUCCEEDED(rc);
+    return g_source->read(g_source->heapBase() + heapOffset, buf, size);
 }
 
 // Resolve a pointer chain and write a block of memory at the final address.
 // chain[0] is the offset from main NSO base; chain[1..n-1] are dereference offsets.
 inline bool writeBlock(const uint64_t* chain, int chainLen, const uint8_t* buf, size_t size) {
-    if (!g_initialized || chainLen < 1) return false;
-
-    uint64_t addr = g_meta.main_nso_extents.base + chain[0];
+    uint64_t addr = 0;
+    if (!resolveChain(chain, chainLen, addr)) return false;
 
-    for (int i = 1; i < chainLen; i++) {
-        uint64_t ptr = 0;
-        Result rc = dmntchtReadCheatProcessMemory(addr, &ptr, sizeof(uint64_t));
-        if (R_FAILED(rc) || ptr == 0) return false;
-        addr = ptr + chain[i];
-    }
-
-    Result rc = dmntchtWriteCheatProcessMemory(addr, buf, size);
-    return R_SUCCEEDED(rc);
+    return g_source->write(addr, buf, size);
 }
 
 } // namespace DmntMem
-
-#endif // __SWITCH__
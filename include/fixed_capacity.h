@@ -0,0 +1,113 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// Containers with inline storage and a compile-time capacity, for code that
+// must not touch the heap (the overlay's scan path). They mirror the slice
+// of the std::vector / std::unordered_map interfaces that code uses, so one
+// source builds against either.
+
+// Vector with room for N elements. Growing past N drops the extra elements:
+// callers bound their input to the capacity.
+template <class T, size_t N>
+class FixedVector {
+public:
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    static constexpr size_t capacity() { return N; }
+
+    T* data() { return items_; }
+    const T* data() const { return items_; }
+    T* begin() { return items_; }
+    T* end() { return items_ + size_; }
+    const T* begin() const { return items_; }
+    const T* end() const { return items_ + size_; }
+    T& operator[](size_t i) { return items_[i]; }
+    const T& operator[](size_t i) const { return items_[i]; }
+    T& back() { return items_[size_ - 1]; }
+    const T& back() const { return items_[size_ - 1]; }
+
+    void clear() { size_ = 0; }
+    void reserve(size_t) {}
+    void push_back(const T& v) {
+        if (size_ < N) items_[size_++] = v;
+    }
+    void resize(size_t n, const T& v = T()) {
+        if (n > N) n = N;
+        for (size_t i = size_; i < n; i++) items_[i] = v;
+        size_ = n;
+    }
+    void assign(size_t n, const T& v) {
+        size_ = 0;
+        resize(n, v);
+    }
+    template <class It, class = decltype(*std::declval<It&>())>
+    void assign(It first, It last) {
+        size_ = 0;
+        for (; first != last && size_ < N; ++first) items_[size_++] = *first;
+    }
+    void swap(FixedVector& o) { std::swap(*this, o); }
+
+    bool operator==(const FixedVector& o) const {
+        if (size_ != o.size_) return false;
+        for (size_t i = 0; i < size_; i++)
+            if (!(items_[i] == o.items_[i])) return false;
+        return true;
+    }
+
+private:
+    T items_[N];
+    size_t size_ = 0;
+};
+
+// Open-addressing hash map with N slots (a power of two) and no erase. It
+// holds at most MAX_SIZE entries; emplace() into a full map fails with
+// {nullptr, false}, so callers clear it first, as they would a bounded cache.
+template <class K, class V, size_t N, class Hash>
+class FixedMap {
+    static_assert(N != 0 && (N & (N - 1)) == 0, "slot count must be a power of two");
+
+public:
+    static constexpr size_t MAX_SIZE = N / 4 * 3;
+
+    struct Entry {
+        K first;
+        V second;
+    };
+
+    size_t size() const { return size_; }
+    void clear() {
+        for (size_t i = 0; i < N; i++) used_[i] = 0;
+        size_ = 0;
+    }
+
+    Entry* end() const { return nullptr; }
+    Entry* find(const K& key) {
+        size_t i = slotFor(key);
+        return used_[i] ? &slots_[i] : nullptr;
+    }
+    size_t count(const K& key) const { return used_[slotFor(key)] ? 1 : 0; }
+
+    std::pair<Entry*, bool> emplace(const K& key, const V& value) {
+        size_t i = slotFor(key);
+        if (used_[i]) return {&slots_[i], false};
+        if (size_ >= MAX_SIZE) return {nullptr, false};
+        used_[i] = 1;
+        slots_[i] = {key, value};
+        size_++;
+        return {&slots_[i], true};
+    }
+
+private:
+    Entry slots_[N];
+    uint8_t used_[N] = {};
+    size_t size_ = 0;
+
+    // The slot holding `key`, or the empty slot where it would go.
+    size_t slotFor(const K& key) const {
+        size_t i = Hash()(key) & (N - 1);
+        while (used_[i] && !(slots_[i].first == key)) i = (i + 1) & (N - 1);
+        return i;
+    }
+};
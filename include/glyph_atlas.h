@@ -0,0 +1,58 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Glyph-atlas text renderer.
+//
+// Each font gets one ATLAS_SIZE x ATLAS_SIZE texture holding every glyph it
+// has drawn so far, rasterized once in white. A string is laid out from glyph
+// advances (plus kerning) and drawn as one SDL_RenderGeometry batch whose
+// vertex colour tints the glyphs, so memory and upload cost scale with the
+// number of distinct glyphs rather than distinct (string, colour) pairs.
+class GlyphAtlas {
+public:
+    static constexpr int ATLAS_SIZE = 512;
+
+    ~GlyphAtlas() { free(); }
+
+    void setRenderer(SDL_Renderer* renderer) { renderer_ = renderer; }
+
+    // Width of the laid-out string in pixels; height is the font height.
+    int measure(TTF_Font* font, const std::string& text);
+    int height(TTF_Font* font) const { return TTF_FontHeight(font); }
+
+    // Draw with the top-left of the line box at (x, y).
+    void draw(TTF_Font* font, const std::string& text, int x, int y, SDL_Color color);
+
+    // Destroy all atlas textures (must run before the renderer is destroyed).
+    void free();
+
+private:
+    struct Glyph {
+        SDL_Rect src = {0, 0, 0, 0};  // w == 0: nothing to draw (e.g. space)
+        int offsetX = 0;              // cell origin relative to the pen
+        int advance = 0;
+    };
+    struct FontAtlas {
+        SDL_Texture* tex = nullptr;
+        std::unordered_map<uint32_t, Glyph> glyphs;
+        int shelfX = 0, shelfY = 0, shelfH = 0;
+        bool reset = false;  // set when the atlas was wiped to make room
+    };
+
+    SDL_Renderer* renderer_ = nullptr;
+    std::unordered_map<TTF_Font*, FontAtlas> fonts_;
+    std::vector<SDL_Vertex> verts_;
+    std::vector<int> indices_;
+    std::vector<uint32_t> codepoints_;
+
+    FontAtlas* atlasFor(TTF_Font* font);
+    const Glyph& glyph(TTF_Font* font, FontAtlas& fa, uint32_t cp);
+    bool place(FontAtlas& fa, int w, int h, SDL_Rect& out);
+    void clearAtlas(FontAtlas& fa);
+    void decode(const std::string& text);
+};
@@ -0,0 +1,84 @@
+#pragma once
+#include "thread_util.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Background poller for live mode.
+//
+// A worker thread calls `poll` every `intervalMs`; whatever patches it
+// produces are queued for the UI thread, which collects them with take() once
+// per frame and applies them to its own copy of the data. The poll function
+// owns all game-memory access while the watch runs (DmntMem is single-threaded),
+// so the UI thread must not read memory between start() and stop().
+template <class Patch>
+class LiveWatch {
+public:
+    // Fill `out` with changes since the previous call; return false when
+    // nothing changed (or the read failed) so the batch is dropped.
+    using PollFn = std::function<bool(std::vector<Patch>& out)>;
+
+    LiveWatch() = default;
+    ~LiveWatch() { stop(); }
+
+    LiveWatch(const LiveWatch&) = delete;
+    LiveWatch& operator=(const LiveWatch&) = delete;
+
+    void start(uint32_t intervalMs, PollFn poll) {
+        stop();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = false;
+            pending_.clear();
+        }
+        worker_ = std::thread([this, intervalMs, poll = std::move(poll)] {
+            ThreadUtil::moveToSpareCore(1);
+            std::vector<Patch> batch;
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (!cv_.wait_for(lock, std::chrono::milliseconds(intervalMs),
+                                 [this] { return stopping_; })) {
+                lock.unlock();
+                batch.clear();
+                bool changed = poll(batch);
+                lock.lock();
+                if (changed)
+                    for (auto& p : batch) pending_.push_back(std::move(p));
+            }
+        });
+    }
+
+    // Wake the worker and join it. Patches not yet taken are discarded.
+    void stop() {
+        if (!worker_.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        worker_.join();
+        pending_.clear();
+    }
+
+    bool running() const { return worker_.joinable(); }
+
+    // UI thread: move out every patch queued since the last call, oldest
+    // first. Returns false (leaving `out` empty) when there were none.
+    bool take(std::vector<Patch>& out) {
+        out.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pending_.empty()) return false;
+        out.swap(pending_);
+        return true;
+    }
+
+private:
+    std::thread worker_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<Patch> pending_;
+    bool stopping_ = false;
+};
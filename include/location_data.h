@@ -15,6 +15,10 @@ public:
               const std::string& kitakamiPath,
               const std::string& blueberryPath);
 
+    // Load a single map's locations. Maps are independent, so different maps
+    // may be loaded concurrently; the same map must not be loaded twice at once.
+    bool loadMap(TeraRaidMapParent map, const std::string& path);
+
     // Get coordinates for a raid. Returns false if not found.
     bool getCoord(TeraRaidMapParent map, uint32_t areaID, uint32_t lotteryGroup, uint32_t spawnPointID, RaidCoord& out) const;
 
@@ -43,6 +47,22 @@ private:
         }
     }
 
+    std::unordered_map<std::string, RaidCoord>& getMapMut(TeraRaidMapParent m) {
+        switch (m) {
+            case TeraRaidMapParent::Kitakami:  return kitakami_;
+            case TeraRaidMapParent::Blueberry: return blueberry_;
+            default:                           return paldea_;
+        }
+    }
+
+    MapBounds& getBoundsMut(TeraRaidMapParent m) {
+        switch (m) {
+            case TeraRaidMapParent::Kitakami:  return kitakamiBounds_;
+            case TeraRaidMapParent::Blueberry: return blueberryBounds_;
+            default:                           return paldeaBounds_;
+        }
+    }
+
     const MapBounds& getBoundsCache(TeraRaidMapParent m) const {
         switch (m) {
             case TeraRaidMapParent::Kitakami:  return kitakamiBounds_;
@@ -0,0 +1,90 @@
+#pragma once
+#include "memory_source.h"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Record/replay of live-mode memory traffic.
+//
+// RecordingSource sits between DmntMem and the real source and appends every
+// read and write (address, size, bytes, time since start) to a capture file.
+// Records go through a large stdio buffer, so recording is cheap enough to
+// leave on for a whole session. ReplaySource serves a capture back: each read
+// returns the bytes recorded for the same (address, size), in capture order,
+// so RaidReader/PlaReader runs are reproducible off the console.
+//
+// Capture layout (little-endian), append-only after the header:
+//   u32 magic 'PKRC', u16 version, u16 reserved,
+//   u64 titleId, u64 mainBase, u64 heapBase,
+//   records: {u8 kind, u32 size, u64 addr, u64 micros, u8 bytes[n]}
+//   where n = size for Read/Write and 0 for ReadFailed/WriteFailed.
+namespace MemoryCapture {
+    constexpr uint32_t MAGIC = 0x43524B50;  // 'PKRC'
+    constexpr uint16_t VERSION = 1;
+    constexpr size_t   HEADER_SIZE = 32;
+    constexpr size_t   RECORD_HEADER_SIZE = 21;
+
+    enum Kind : uint8_t { Read = 0, ReadFailed = 1, Write = 2, WriteFailed = 3 };
+}
+
+class RecordingSource final : public MemorySource {
+public:
+    explicit RecordingSource(MemorySource& inner) : inner_(inner) {}
+    ~RecordingSource() override { close(); }
+
+    RecordingSource(const RecordingSource&) = delete;
+    RecordingSource& operator=(const RecordingSource&) = delete;
+
+    // Create the capture file and write its header from the inner source's
+    // identity. Until this succeeds calls are forwarded without recording.
+    bool open(const std::string& path);
+    void close();
+
+    uint64_t titleId() const override { return inner_.titleId(); }
+    uint64_t mainBase() const override { return inner_.mainBase(); }
+    uint64_t heapBase() const override { return inner_.heapBase(); }
+    bool read(uint64_t addr, void* buf, size_t size) override;
+    bool write(uint64_t addr, const void* buf, size_t size) override;
+
+private:
+    MemorySource& inner_;
+    FILE* file_ = nullptr;
+    std::vector<char> buffer_;
+    std::chrono::steady_clock::time_point start_;
+
+    void append(MemoryCapture::Kind kind, uint64_t addr, const void* bytes, size_t size);
+};
+
+class ReplaySource final : public MemorySource {
+public:
+    bool load(const std::string& path);
+
+    uint64_t titleId() const override { return titleId_; }
+    uint64_t mainBase() const override { return mainBase_; }
+    uint64_t heapBase() const override { return heapBase_; }
+    bool read(uint64_t addr, void* buf, size_t size) override;
+    bool write(uint64_t addr, const void* buf, size_t size) override;
+
+    // Start serving from the first record again.
+    void rewind() { cursor_ = 0; }
+    // Reads that matched no record (the replayed code diverged from the capture).
+    size_t misses() const { return misses_; }
+    size_t recordCount() const { return records_.size(); }
+
+private:
+    struct Record {
+        MemoryCapture::Kind kind;
+        uint32_t size;
+        uint64_t addr;
+        uint64_t micros;
+        size_t   offset;  // into data_
+    };
+    std::vector<Record> records_;
+    std::vector<uint8_t> data_;
+    size_t cursor_ = 0;
+    size_t misses_ = 0;
+    uint64_t titleId_ = 0, mainBase_ = 0, heapBase_ = 0;
+
+    const Record* next(bool isRead, uint64_t addr, size_t size);
+};
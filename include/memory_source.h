@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Where live-mode readers get game memory from.
+//
+// DmntMem's chain/heap helpers dispatch through the active source: on the
+// Switch that is dmnt:cht attached to the running game; elsewhere a recorded
+// image can be installed with DmntMem::setSource() so RaidReader, DenCrawler
+// and PlaReader run unchanged against captured memory.
+class MemorySource {
+public:
+    virtual ~MemorySource() = default;
+
+    virtual uint64_t titleId() const = 0;
+    virtual uint64_t mainBase() const = 0;  // main NSO base (chain[0] is relative to it)
+    virtual uint64_t heapBase() const = 0;  // heap base (readHeap offsets are relative to it)
+
+    // Absolute-address access. Return false if any byte is unavailable.
+    virtual bool read(uint64_t addr, void* buf, size_t size) = 0;
+    virtual bool write(uint64_t addr, const void* buf, size_t size) = 0;
+};
+
+// Serves a memory image from a file: the process identity plus a set of
+// segments (e.g. the main NSO and the heap ranges a reader touches), each with
+// its original base address. Writes modify the in-memory copy only.
+//
+// File layout (little-endian):
+//   u32 magic 'PKMI', u16 version, u16 segmentCount,
+//   u64 titleId, u64 mainBase, u64 heapBase,
+//   segmentCount x {u64 base, u64 size, u8 bytes[size]}
+class FileMemorySource final : public MemorySource {
+public:
+    static constexpr uint32_t MAGIC = 0x494D4B50;  // 'PKMI'
+    static constexpr uint16_t VERSION = 1;
+
+    bool load(const std::string& path);
+    bool save(const std::string& path) const;
+
+    void setIdentity(uint64_t titleId, uint64_t mainBase, uint64_t heapBase);
+    // Overlapping an existing segment is not supported; later reads see
+    // whichever segment starts closest below the address.
+    void addSegment(uint64_t base, std::vector<uint8_t> bytes);
+
+    uint64_t titleId() const override { return titleId_; }
+    uint64_t mainBase() const override { return mainBase_; }
+    uint64_t heapBase() const override { return heapBase_; }
+    bool read(uint64_t addr, void* buf, size_t size) override;
+    bool write(uint64_t addr, const void* buf, size_t size) override;
+
+private:
+    struct Segment {
+        uint64_t base;
+        std::vector<uint8_t> bytes;
+    };
+    std::vector<Segment> segments_;  // sorted by base
+    uint64_t titleId_ = 0;
+    uint64_t mainBase_ = 0;
+    uint64_t heapBase_ = 0;
+
+    Segment* segmentAt(uint64_t addr);
+};
@@ -0,0 +1,41 @@
+#pragma once
+#include "fixed_capacity.h"
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+// Storage policy for the PLA core, chosen at build time.
+//
+// The app builds with growable std containers. The overlay builds with
+// -DPLA_FIXED_CAPACITY=1 (overlay/Makefile): every container on the scan and
+// decorate path becomes a FixedVector / FixedMap sized by the limits below
+// and embedded in PlaReader, so a scan allocates nothing from the overlay's
+// heap and the reader's footprint is known up front (sizeof(PlaReader)).
+#ifndef PLA_FIXED_CAPACITY
+#define PLA_FIXED_CAPACITY 0
+#endif
+
+namespace PlaConfig {
+
+constexpr size_t MAX_GROUPS    = 256;    // spawner groups read per scan
+constexpr size_t MAX_POSITIONS = 4096;   // live-position list entries
+
+#if PLA_FIXED_CAPACITY
+// Shiny tables kept across rescans: room for a full scan plus change.
+constexpr size_t SHINY_MEMO_SLOTS = 512;
+constexpr size_t SHINY_MEMO_MAX   = FixedMap<int, int, SHINY_MEMO_SLOTS, std::hash<int>>::MAX_SIZE;
+// Live-grid cells per axis; fewer, larger cells keep the offset table small.
+constexpr int    LIVE_GRID_CELLS  = 64;
+
+template <class T, size_t N> using List = FixedVector<T, N>;
+template <class K, class V, class Hash> using Memo = FixedMap<K, V, SHINY_MEMO_SLOTS, Hash>;
+#else
+// A few days of seeds across every region.
+constexpr size_t SHINY_MEMO_MAX   = 4096;
+constexpr int    LIVE_GRID_CELLS  = 256;
+
+template <class T, size_t N> using List = std::vector<T>;
+template <class K, class V, class Hash> using Memo = std::unordered_map<K, V, Hash>;
+#endif
+
+} // namespace PlaConfig
@@ -45,6 +45,37 @@ inline Fixed generateFromSeed(uint64_t seed, int rolls, int guaranteedIvs) {
     return f;
 }
 
+// Every shiny roll count the game uses (research level, shiny charm,
+// outbreaks) fits in this many PID rolls.
+constexpr int MAX_SHINY_ROLLS = 32;
+
+// Index (0-based) of the first shiny PID roll among the first `maxRolls`, or
+// -1. The rolls are a prefix of one PID sequence, so a spawn is shiny with
+// `rolls` rolls exactly when 0 <= index < rolls: one draw answers every count.
+inline int firstShinyRoll(uint64_t seed, int maxRolls) {
+    Xoroshiro128Plus rng(seed);
+    rng.nextInt(0xFFFFFFFFULL);             // EC
+    uint32_t sidtid = static_cast<uint32_t>(rng.nextInt(0xFFFFFFFFULL));
+    for (int i = 0; i < maxRolls; i++) {
+        uint32_t pid = static_cast<uint32_t>(rng.nextInt(0xFFFFFFFFULL));
+        uint32_t x = (pid >> 16) ^ (sidtid >> 16) ^ (pid & 0xFFFF) ^ (sidtid & 0xFFFF);
+        if (x < 0x10) return i;
+    }
+    return -1;
+}
+
+// First shiny advance (as nextShiny with initSpawn=true) for every roll count
+// 1..MAX_SHINY_ROLLS, from a single walk of the group RNG.
+struct ShinyTable {
+    int advance[MAX_SHINY_ROLLS];           // [rolls - 1]; -1 = none within maxAdvance
+
+    int forRolls(int rolls) const {
+        if (rolls < 1) rolls = 1;
+        if (rolls > MAX_SHINY_ROLLS) rolls = MAX_SHINY_ROLLS;
+        return advance[rolls - 1];
+    }
+};
+
 // Advance the group RNG and search for the first advance whose init spawn is shiny.
 // Returns advance count (0 = current). -1 if none within `maxAdvance`.
 // initSpawn=true means: the current generator_seed is the initial spawn; don't advance first.
@@ -71,15 +102,49 @@ inline int nextShiny(uint64_t groupSeed, int rolls, int guaranteedIvs,
     return -1;
 }
 
+// Reference walk for ShinyTable (PlaShinySearch::runTables is the batched
+// version). Each shiny advance settles every still-open count above its roll
+// index, so the walk ends at the first 1-roll shiny.
+inline ShinyTable shinyTable(uint64_t groupSeed, int maxAdvance) {
+    ShinyTable t;
+    for (int i = 0; i < MAX_SHINY_ROLLS; i++) t.advance[i] = -1;
+    int open = MAX_SHINY_ROLLS;             // counts 1..open are unresolved
+    Xoroshiro128Plus main(groupSeed);
+    for (int adv = 0; adv <= maxAdvance && open > 0; adv++) {
+        uint64_t gen = main.next();
+        main.next();                        // spawner 1's seed, unused
+        Xoroshiro128Plus spawner(gen);
+        spawner.next();                     // slot roll, unused
+        int idx = firstShinyRoll(spawner.next(), open);
+        if (idx >= 0) {
+            for (int r = idx + 1; r <= open; r++) t.advance[r - 1] = adv;
+            open = idx;
+        }
+        uint64_t r = main.next();
+        main.s0 = r; main.s1 = Xoroshiro128Plus::XOROSHIRO_CONST;
+    }
+    return t;
+}
+
+// Raw slot roll of the init spawn (what firstFixed reports), without
+// generating the Pokemon.
+inline uint64_t firstSlotRaw(uint64_t groupSeed) {
+    Xoroshiro128Plus main(groupSeed);
+    uint64_t r = main.next();
+    main.s0 = r; main.s1 = Xoroshiro128Plus::XOROSHIRO_CONST;
+    return main.next();
+}
+
 // Compute the init-spawn details from a group seed (no advance).
-// If outSlotRoll is non-null, stores the slot roll in [0, 1) — multiply by slotTotal.
+// If outSlotRaw is non-null, stores the raw 64-bit slot roll for
+// PlaMarkers::resolveSlotRaw.
 inline Fixed firstFixed(uint64_t groupSeed, int rolls, int guaranteedIvs,
-                        double* outSlotRoll = nullptr) {
+                        uint64_t* outSlotRaw = nullptr) {
     Xoroshiro128Plus main(groupSeed);
     uint64_t r = main.next();
     main.s0 = r; main.s1 = Xoroshiro128Plus::XOROSHIRO_CONST;
     uint64_t slotRaw = main.next();
-    if (outSlotRoll) *outSlotRoll = (double)slotRaw / 18446744073709551616.0; // 2^64
+    if (outSlotRaw) *outSlotRaw = slotRaw;
     uint64_t fixedSeed = main.next();
     return generateFromSeed(fixedSeed, rolls, guaranteedIvs);
 }
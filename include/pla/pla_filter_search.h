@@ -0,0 +1,52 @@
+#pragma once
+#include "pla/pla_encounter.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace PlaMarkers { struct Marker; }
+
+// First advance per spawner whose init spawn matches a filter on slot
+// (species, alpha), shininess, IVs and nature - "next alpha", "next 0 Atk",
+// "next shiny Adamant" and the like.
+//
+// Each job compiles the filter into the checks it actually needs, in RNG
+// order. Species and alpha become the raw slot-roll ranges of the marker's
+// accepted slots (from SLOT_CUMULATIVE), tested on the spawner's first draw
+// before the fixed seed is touched; PID rolls, IVs and nature then each bail
+// out as soon as they fail, so a spawn is generated only as far as the filter
+// looks. A shiny-only filter walks exactly like PlaShinySearch. Jobs are
+// spread across threads the same way.
+namespace PlaFilterSearch {
+
+struct Filter {
+    bool     shiny     = false;
+    int8_t   alpha     = -1;        // 1 alpha only, 0 non-alpha only, -1 either
+    uint16_t speciesId = 0;         // national dex id; 0 = any
+    int8_t   nature    = -1;        // 0..24; -1 = any
+    uint8_t  ivMin[6]  = {0, 0, 0, 0, 0, 0};
+    uint8_t  ivMax[6]  = {31, 31, 31, 31, 31, 31};
+};
+
+struct Job {
+    uint64_t groupSeed;
+    int      shinyRolls;
+    int      guaranteedIvs;
+    const PlaMarkers::Marker* marker;   // slot table; species/alpha filters need one
+};
+
+struct Options {
+    uint32_t maxAdvance = 1000000;  // inclusive
+    int      threads    = 1;        // total threads including the caller
+    // Polled between advances; when set, run() returns early and unfinished
+    // jobs report -1.
+    const std::atomic<bool>* cancel = nullptr;
+};
+
+// out[j]: first matching advance for jobs[j] (0 = current init spawn), or -1
+// when there is none within maxAdvance or no slot at the marker can match.
+// Blocks until done; extra threads are moved to spare cores 1...
+void run(const Job* jobs, size_t count, const Filter& filter, const Options& options,
+         int* out);
+
+} // namespace PlaFilterSearch
@@ -0,0 +1,40 @@
+#pragma once
+#include "pla/pla_config.h"
+#include <cstddef>
+#include <cstdint>
+
+struct PlaLivePos { float x, y, z; };
+
+// Uniform grid over the live-position list (x/z plane), rebuilt once per scan.
+// A marker's activity check then only visits the cells within the search
+// radius instead of every live position.
+class PlaLiveGrid {
+public:
+    // Bucket `count` positions into square cells of `cellSize` world units.
+    // The grid keeps a pointer to `positions`; rebuild after they change.
+    // At most PlaConfig::MAX_POSITIONS are indexed.
+    void build(const PlaLivePos* positions, size_t count, float cellSize);
+
+    // Nearest position within `radius` of (x, z), or nullptr if none.
+    const PlaLivePos* nearest(float x, float z, float radius) const;
+
+private:
+    // Cap per axis so garbage coordinates cannot blow up the cell count;
+    // cells grow instead.
+    static constexpr int MAX_CELLS_PER_AXIS = PlaConfig::LIVE_GRID_CELLS;
+    static constexpr size_t MAX_CELLS = (size_t)MAX_CELLS_PER_AXIS * MAX_CELLS_PER_AXIS;
+
+    template <class T, size_t N> using List = PlaConfig::List<T, N>;
+
+    const PlaLivePos* positions_ = nullptr;
+    float minX_ = 0.0f, minZ_ = 0.0f, cell_ = 1.0f;
+    int cols_ = 0, rows_ = 0;
+    List<uint32_t, MAX_CELLS + 1> cellStart_;            // cols_*rows_ + 1 offsets into items_
+    List<uint32_t, PlaConfig::MAX_POSITIONS> items_;     // position indices, grouped by cell
+    // build() scratch, kept so rebuilds reuse it.
+    List<uint32_t, PlaConfig::MAX_POSITIONS> cellOf_;    // cell per position
+    List<uint32_t, MAX_CELLS> fill_;                     // next free slot per cell
+
+    int cellX(float x) const;
+    int cellZ(float z) const;
+};
@@ -4,6 +4,7 @@
 //   markers: Lincoln-LM/JS-Finder Resources/pla_spawners/jsons/*.json
 //   slots:   Lincoln-LM/PLA-Live-Map static/resources/*.json
 #include "pla/pla_region.h"
+#include <algorithm>
 #include <cstdint>
 #include <cstddef>
 
@@ -4861,6 +4862,313 @@ inline constexpr SlotEntry SLOTS[] = {
 };
 inline constexpr size_t SLOTS_COUNT = 4829;
 
+// SLOT_CUMULATIVE[m.slotOffset + i]: total weight of the marker's slots 0..i,
+// so the last entry of each run equals m.slotTotal.
+inline constexpr uint16_t SLOT_CUMULATIVE[] = {
+    1, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102,
+    100, 102, 100, 100, 100, 100, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102,
+    100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 112, 113,
+    100, 102, 112, 113, 100, 102, 112, 113, 100, 102, 100, 102, 122, 123, 100, 102,
+    103, 100, 102, 202, 204, 100, 102, 202, 204, 224, 225, 100, 102, 122, 123, 100,
+    102, 122, 123, 100, 102, 202, 204, 100, 102, 202, 204, 100, 102, 100, 102, 100,
+    102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 112, 113, 100, 102, 100,
+    102, 100, 102, 112, 113, 100, 102, 100, 102, 100, 102, 112, 113, 100, 101, 100,
+    102, 112, 113, 100, 101, 100, 102, 162, 163, 100, 102, 162, 163, 100, 102, 100,
+    100, 102, 100, 102, 100, 100, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102,
+    100, 100, 100, 102, 100, 102, 100, 102, 100, 101, 100, 102, 112, 113, 100, 102,
+    112, 113, 100, 100, 102, 100, 102, 112, 113, 100, 102, 100, 102, 100, 100, 102,
+    100, 100, 102, 100, 102, 100, 102, 112, 113, 100, 102, 100, 102, 100, 100, 102,
+    100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102,
+    100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 100, 102, 152, 153, 100, 102,
+    152, 153, 100, 102, 152, 153, 20, 21, 31, 32, 132, 134, 100, 102, 100, 102,
+    100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 152, 153, 100, 102, 152, 153,
+    20, 21, 31, 32, 132, 134, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102,
+    152, 153, 100, 102, 152, 153, 20, 21, 31, 32, 132, 134, 20, 21, 31, 32,
+    132, 134, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102,
+    152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102,
+    100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 100, 102, 152, 153, 100, 102,
+    100, 102, 152, 153, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102,
+    100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 102, 10, 11, 16, 17,
+    117, 119, 169, 170, 100, 101, 100, 102, 152, 153, 100, 101, 100, 102, 100, 102,
+    10, 11, 16, 17, 117, 119, 169, 170, 100, 102, 100, 102, 152, 153, 100, 102,
+    162, 163, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102,
+    162, 163, 100, 102, 162, 163, 100, 102, 162, 163, 100, 102, 162, 163, 100, 102,
+    162, 163, 100, 102, 162, 163, 25, 27, 52, 54, 25, 27, 52, 54, 25, 27,
+    52, 54, 25, 27, 52, 54, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102,
+    152, 153, 25, 27, 100, 102, 152, 153, 25, 27, 52, 54, 25, 27, 25, 27,
+    100, 102, 152, 153, 25, 27, 100, 102, 152, 153, 100, 101, 100, 101, 100, 101,
+    100, 102, 152, 153, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101,
+    100, 101, 100, 101, 100, 101, 50, 52, 50, 52, 100, 101, 100, 101, 100, 102,
+    152, 153, 100, 102, 152, 153, 100, 102, 100, 102, 100, 102, 112, 113, 100, 102,
+    112, 113, 100, 102, 112, 113, 50, 52, 152, 153, 163, 164, 174, 175, 50, 52,
+    152, 153, 163, 164, 174, 175, 50, 52, 152, 153, 163, 164, 174, 175, 50, 52,
+    152, 153, 163, 164, 174, 175, 50, 52, 152, 153, 163, 164, 174, 175, 100, 102,
+    100, 102, 100, 102, 152, 153, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102,
+    100, 101, 201, 202, 100, 102, 100, 102, 100, 101, 201, 202, 100, 101, 201, 202,
+    100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102,
+    152, 153, 100, 102, 100, 101, 104, 105, 100, 102, 152, 153, 100, 102, 100, 102,
+    152, 153, 100, 102, 162, 163, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102,
+    152, 153, 100, 102, 100, 101, 100, 102, 152, 153, 100, 101, 100, 101, 100, 101,
+    131, 132, 100, 101, 100, 101, 131, 132, 100, 102, 132, 133, 100, 101, 100, 101,
+    131, 132, 100, 101, 131, 132, 100, 101, 131, 132, 100, 101, 131, 132, 100, 101,
+    131, 132, 100, 101, 131, 132, 100, 101, 131, 132, 100, 102, 132, 133, 100, 102,
+    132, 133, 100, 102, 152, 153, 100, 102, 152, 153, 100, 101, 100, 101, 100, 101,
+    100, 101, 100, 101, 100, 101, 100, 102, 132, 133, 100, 102, 132, 133, 100, 102,
+    152, 153, 100, 101, 131, 132, 100, 101, 131, 132, 100, 101, 151, 152, 100, 101,
+    131, 132, 100, 101, 131, 132, 100, 102, 152, 153, 100, 101, 131, 132, 100, 102,
+    152, 153, 100, 102, 162, 163, 100, 101, 100, 102, 152, 153, 100, 101, 131, 132,
+    100, 102, 100, 102, 100, 102, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 102, 100, 102, 100,
+    102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100,
+    102, 100, 102, 142, 143, 153, 154, 184, 185, 100, 102, 152, 153, 100, 102, 152,
+    153, 100, 102, 152, 153, 100, 102, 122, 123, 100, 102, 122, 123, 100, 102, 122,
+    123, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 112,
+    113, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 40, 41, 141,
+    143, 193, 194, 100, 102, 100, 102, 152, 153, 100, 102, 100, 102, 152, 153, 100,
+    102, 152, 153, 100, 102, 100, 102, 40, 41, 141, 143, 193, 194, 100, 102, 152,
+    153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 100,
+    102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 100, 102, 100,
+    102, 100, 102, 152, 153, 100, 102, 100, 100, 102, 152, 153, 100, 100, 102, 100,
+    100, 100, 100, 102, 100, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 100,
+    100, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100,
+    102, 152, 153, 100, 102, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 100,
+    102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 152,
+    153, 100, 102, 132, 133, 100, 102, 132, 133, 100, 102, 132, 133, 100, 102, 132,
+    133, 100, 102, 132, 133, 100, 102, 132, 133, 100, 102, 132, 133, 100, 102, 132,
+    133, 100, 102, 132, 133, 100, 102, 132, 133, 100, 102, 132, 133, 100, 102, 132,
+    133, 100, 102, 132, 133, 100, 102, 100, 101, 100, 101, 100, 102, 100, 101, 100,
+    102, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152,
+    153, 100, 102, 100, 102, 152, 153, 100, 102, 152, 153, 100, 101, 100, 102, 100,
+    102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 152,
+    153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 100,
+    102, 100, 102, 20, 21, 121, 122, 20, 21, 121, 122, 100, 102, 152, 153, 100,
+    102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100,
+    102, 152, 153, 100, 102, 100, 100, 100, 100, 102, 100, 102, 100, 102, 100, 102,
+    152, 153, 100, 102, 100, 102, 100, 102, 152, 153, 100, 102, 100, 101, 100, 102,
+    152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 100, 100, 100, 102,
+    152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 100, 102, 100, 102, 100,
+    102, 132, 133, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 132, 133, 100,
+    102, 132, 133, 100, 102, 132, 133, 100, 102, 100, 102, 100, 102, 100, 102, 100,
+    102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 152,
+    153, 40, 41, 141, 143, 193, 194, 40, 41, 141, 143, 193, 194, 100, 102, 40,
+    41, 141, 143, 193, 194, 100, 102, 100, 102, 100, 102, 152, 153, 40, 41, 141,
+    143, 193, 194, 100, 102, 100, 102, 152, 153, 100, 102, 104, 105, 100, 102, 104,
+    105, 100, 102, 104, 105, 100, 101, 100, 102, 100, 102, 104, 105, 100, 102, 100,
+    102, 104, 105, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 101, 100,
+    102, 100, 102, 104, 105, 100, 101, 100, 102, 100, 102, 100, 102, 104, 105, 100,
+    102, 100, 102, 100, 102, 132, 133, 100, 102, 132, 133, 100, 102, 100, 102, 152,
+    153, 100, 102, 152, 153, 100, 102, 100, 102, 152, 153, 100, 102, 152, 153, 100,
+    102, 152, 153, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100,
+    102, 100, 102, 132, 133, 100, 102, 100, 102, 100, 102, 152, 153, 100, 102, 152,
+    153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152,
+    153, 100, 102, 152, 153, 100, 100, 100, 100, 102, 152, 153, 178, 179, 189, 190,
+    100, 102, 142, 143, 100, 102, 142, 143, 100, 102, 142, 143, 100, 102, 142, 143,
+    100, 102, 142, 143, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153,
+    100, 102, 104, 105, 100, 102, 104, 105, 100, 102, 152, 153, 100, 102, 152, 153,
+    100, 100, 100, 100, 100, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152,
+    153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152,
+    153, 100, 102, 104, 105, 100, 100, 101, 104, 105, 100, 102, 152, 153, 100, 102,
+    100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 152, 153, 100, 102, 152, 153,
+    100, 102, 152, 153, 100, 102, 100, 102, 100, 102, 100, 102, 152, 153, 100, 102,
+    152, 153, 100, 102, 100, 100, 102, 152, 153, 100, 100, 100, 102, 152, 153, 100,
+    102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 100, 100, 102,
+    100, 102, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102,
+    152, 153, 100, 102, 100, 102, 100, 100, 100, 100, 102, 100, 102, 152, 153, 100,
+    102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 100, 102, 152,
+    153, 100, 102, 152, 153, 100, 102, 100, 102, 100, 102, 152, 153, 100, 102, 152,
+    153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152,
+    153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152,
+    153, 100, 102, 100, 102, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152,
+    153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 100, 100,
+    102, 152, 153, 100, 102, 100, 102, 100, 100, 102, 100, 102, 100, 102, 100, 102,
+    100, 102, 100, 100, 100, 102, 100, 102, 100, 102, 152, 153, 100, 102, 152, 153,
+    163, 164, 204, 205, 100, 102, 152, 153, 100, 101, 100, 101, 100, 100, 101, 100,
+    102, 100, 101, 100, 101, 100, 101, 100, 100, 100, 100, 102, 100, 102, 60, 62,
+    162, 163, 60, 62, 162, 163, 60, 62, 162, 163, 60, 62, 162, 163, 100, 200,
+    300, 400, 500, 600, 700, 800, 900, 1000, 1100, 1200, 1300, 1400, 1500, 1600, 1700, 1800,
+    1900, 2000, 2100, 2200, 2300, 2400, 2500, 2600, 2700, 2800, 2801, 2802, 2803, 2804, 2805, 2806,
+    2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822,
+    2823, 2824, 2825, 2826, 2827, 2828, 100, 200, 300, 400, 500, 600, 700, 800, 900, 1000,
+    1100, 1200, 1300, 1400, 1500, 1600, 1700, 1800, 1900, 2000, 2100, 2200, 2300, 2400, 2500, 2600,
+    2700, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814,
+    2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 100, 102,
+    132, 133, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    102, 162, 163, 100, 102, 162, 163, 100, 101, 100, 102, 162, 163, 100, 102, 162,
+    163, 100, 102, 162, 163, 100, 101, 100, 102, 162, 163, 100, 102, 162, 163, 100,
+    101, 100, 102, 162, 163, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 102, 162, 163, 100,
+    102, 162, 163, 183, 184, 100, 101, 100, 101, 25, 26, 126, 127, 25, 26, 126,
+    127, 100, 101, 25, 26, 126, 127, 100, 101, 100, 101, 100, 102, 162, 163, 183,
+    184, 100, 101, 100, 101, 25, 26, 126, 127, 100, 101, 20, 21, 121, 122, 25,
+    26, 126, 127, 25, 26, 126, 127, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 20, 21, 121, 122, 20, 21, 121, 122, 100, 101, 111, 112, 100,
+    102, 117, 118, 100, 101, 111, 112, 100, 101, 100, 102, 117, 118, 100, 101, 100,
+    101, 100, 101, 100, 102, 162, 163, 100, 101, 100, 101, 100, 101, 100, 102, 162,
+    163, 100, 101, 100, 102, 162, 163, 100, 102, 162, 163, 100, 102, 162, 163, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 102, 162, 163, 30, 31, 131, 133, 183, 184, 100, 101, 100, 102, 162,
+    163, 30, 31, 131, 133, 183, 184, 100, 102, 162, 163, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 102, 162, 163, 100, 102, 162, 163, 30, 31, 131,
+    133, 183, 184, 30, 31, 131, 133, 183, 184, 100, 102, 162, 163, 100, 101, 100,
+    102, 162, 163, 100, 101, 100, 102, 162, 163, 100, 102, 162, 163, 173, 174, 100,
+    102, 162, 163, 100, 102, 162, 163, 173, 174, 100, 102, 162, 163, 100, 102, 162,
+    163, 173, 174, 100, 102, 162, 163, 173, 174, 100, 102, 162, 163, 173, 174, 100,
+    102, 162, 163, 173, 174, 100, 102, 162, 163, 173, 174, 100, 102, 162, 163, 100,
+    102, 162, 163, 100, 102, 162, 163, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 102, 122, 123, 100, 102, 122, 123, 100, 102, 122,
+    123, 100, 102, 122, 123, 100, 102, 122, 123, 100, 101, 100, 102, 122, 123, 100,
+    101, 100, 101, 100, 101, 100, 102, 122, 123, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 20,
+    21, 26, 27, 127, 129, 159, 160, 100, 102, 162, 163, 100, 101, 100, 101, 100,
+    101, 100, 101, 20, 21, 26, 27, 127, 129, 159, 160, 20, 21, 26, 27, 127,
+    129, 159, 160, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 102, 162,
+    163, 100, 102, 162, 163, 100, 102, 162, 163, 100, 102, 162, 163, 100, 102, 162,
+    163, 100, 102, 162, 163, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 102, 162, 163, 100, 102, 162, 163, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 121, 122, 100, 101, 121, 122, 100, 101, 121, 122, 100, 101, 121,
+    122, 100, 101, 121, 122, 100, 101, 100, 101, 111, 112, 172, 173, 100, 101, 111,
+    112, 172, 173, 100, 101, 111, 112, 172, 173, 100, 101, 111, 112, 172, 173, 100,
+    101, 111, 112, 172, 173, 100, 101, 111, 112, 172, 173, 100, 101, 100, 101, 131,
+    132, 100, 101, 131, 132, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 102, 162, 163, 100, 102, 162, 163, 100,
+    102, 162, 163, 100, 102, 162, 163, 100, 102, 162, 163, 100, 102, 162, 163, 100,
+    102, 162, 163, 100, 102, 162, 163, 100, 102, 162, 163, 100, 102, 162, 163, 100,
+    102, 162, 163, 100, 102, 162, 163, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 102, 162, 163, 20, 21, 51, 52, 152, 154, 204, 205, 100, 102, 152,
+    153, 20, 21, 51, 52, 152, 154, 204, 205, 100, 101, 100, 101, 100, 101, 141,
+    142, 100, 101, 100, 101, 141, 142, 100, 101, 100, 101, 141, 142, 100, 101, 141,
+    142, 100, 102, 162, 163, 100, 102, 162, 163, 100, 102, 162, 163, 100, 101, 100,
+    101, 100, 101, 100, 102, 162, 163, 100, 102, 162, 163, 100, 102, 162, 163, 100,
+    101, 100, 101, 100, 101, 100, 102, 162, 163, 100, 102, 152, 153, 100, 102, 152,
+    153, 100, 102, 152, 153, 100, 101, 100, 101, 100, 102, 152, 153, 100, 102, 152,
+    153, 100, 101, 100, 101, 10, 11, 14, 15, 115, 116, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 10, 11, 14, 15, 115, 116, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    102, 100, 101, 131, 132, 100, 101, 131, 132, 100, 102, 100, 102, 30, 32, 132,
+    133, 100, 102, 30, 32, 132, 133, 100, 101, 131, 132, 100, 102, 100, 101, 131,
+    132, 100, 101, 131, 132, 100, 102, 100, 102, 100, 102, 100, 102, 100, 102, 100,
+    102, 100, 102, 100, 102, 100, 101, 131, 132, 30, 32, 132, 133, 30, 32, 132,
+    133, 30, 32, 132, 133, 30, 32, 132, 133, 30, 32, 132, 133, 100, 101, 100,
+    101, 100, 101, 30, 32, 132, 133, 100, 101, 30, 32, 132, 133, 100, 101, 30,
+    32, 132, 133, 100, 101, 30, 32, 132, 133, 30, 32, 132, 133, 30, 32, 132,
+    133, 100, 102, 100, 101, 100, 102, 30, 32, 132, 133, 30, 32, 132, 133, 193,
+    194, 30, 32, 132, 133, 30, 32, 132, 133, 30, 32, 132, 133, 193, 194, 30,
+    32, 132, 133, 193, 194, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152,
+    153, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 30, 32, 132,
+    133, 30, 32, 132, 133, 30, 32, 132, 133, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 30, 32, 132, 133, 100,
+    101, 100, 102, 152, 153, 100, 101, 100, 101, 100, 101, 30, 32, 132, 133, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 30, 32, 132, 133, 100, 101, 100,
+    101, 100, 101, 100, 102, 152, 153, 100, 101, 100, 102, 152, 153, 100, 101, 100,
+    101, 100, 101, 30, 32, 132, 133, 30, 32, 132, 133, 100, 101, 100, 101, 30,
+    32, 132, 133, 30, 32, 132, 133, 100, 101, 100, 102, 112, 113, 100, 102, 112,
+    113, 100, 101, 100, 102, 132, 133, 163, 165, 100, 102, 112, 113, 100, 101, 100,
+    102, 112, 113, 100, 102, 112, 113, 20, 22, 122, 123, 20, 22, 122, 123, 10,
+    11, 111, 112, 10, 11, 111, 112, 10, 11, 111, 112, 10, 11, 111, 112, 100,
+    101, 100, 101, 100, 101, 100, 101, 10, 11, 111, 112, 10, 11, 111, 112, 100,
+    101, 100, 101, 30, 31, 41, 42, 72, 74, 174, 175, 30, 31, 41, 42, 72,
+    74, 174, 175, 30, 31, 41, 42, 72, 74, 174, 175, 30, 31, 41, 42, 72,
+    74, 174, 175, 30, 31, 41, 42, 72, 74, 174, 175, 30, 31, 41, 42, 72,
+    74, 174, 175, 30, 31, 41, 42, 72, 74, 174, 175, 30, 32, 132, 133, 30,
+    32, 132, 133, 100, 101, 30, 32, 132, 133, 30, 32, 132, 133, 30, 32, 132,
+    133, 30, 32, 132, 133, 100, 101, 100, 101, 30, 32, 132, 133, 30, 32, 132,
+    133, 30, 32, 132, 133, 30, 32, 132, 133, 30, 32, 132, 133, 30, 32, 132,
+    133, 30, 32, 132, 133, 100, 101, 30, 32, 132, 133, 100, 101, 100, 102, 142,
+    143, 100, 101, 100, 102, 142, 143, 30, 32, 132, 133, 100, 101, 100, 101, 30,
+    32, 132, 133, 30, 32, 132, 133, 100, 101, 30, 32, 132, 133, 100, 101, 100,
+    102, 142, 143, 100, 102, 142, 143, 100, 101, 100, 101, 30, 32, 132, 133, 30,
+    32, 132, 133, 30, 32, 132, 133, 30, 32, 132, 133, 30, 32, 132, 133, 30,
+    32, 132, 133, 30, 32, 132, 133, 100, 101, 100, 101, 100, 101, 100, 101, 30,
+    32, 132, 133, 100, 101, 100, 101, 30, 32, 132, 133, 100, 101, 30, 32, 132,
+    133, 30, 32, 132, 133, 30, 32, 132, 133, 100, 101, 100, 101, 30, 32, 132,
+    133, 30, 32, 132, 133, 100, 101, 100, 101, 30, 32, 132, 133, 30, 32, 132,
+    133, 30, 32, 132, 133, 100, 101, 30, 32, 132, 133, 30, 32, 132, 133, 30,
+    32, 132, 133, 100, 101, 30, 32, 132, 133, 30, 32, 132, 133, 30, 32, 132,
+    133, 30, 32, 132, 133, 30, 32, 132, 133, 30, 32, 132, 133, 100, 102, 152,
+    153, 163, 164, 100, 102, 152, 153, 163, 164, 100, 102, 152, 153, 163, 164, 100,
+    102, 152, 153, 163, 164, 100, 102, 152, 153, 163, 164, 100, 102, 132, 133, 100,
+    102, 132, 133, 100, 102, 132, 133, 100, 101, 20, 22, 122, 123, 30, 32, 132,
+    133, 100, 102, 132, 133, 100, 101, 20, 22, 122, 123, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 20, 22, 122, 123, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 20, 22, 122,
+    123, 20, 22, 122, 123, 20, 22, 122, 123, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 102, 107, 108, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 102, 107, 108, 100,
+    101, 100, 102, 107, 108, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 102, 107, 108, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 121, 122, 152, 153, 100, 101, 100, 101, 100, 101, 121,
+    122, 152, 153, 100, 101, 121, 122, 152, 153, 100, 101, 121, 122, 152, 153, 100,
+    101, 121, 122, 162, 163, 173, 174, 100, 101, 106, 107, 100, 101, 20, 22, 122,
+    123, 60, 62, 162, 163, 173, 174, 60, 62, 162, 163, 173, 174, 100, 101, 100,
+    101, 100, 101, 60, 62, 162, 163, 173, 174, 60, 62, 162, 163, 173, 174, 20,
+    22, 122, 123, 20, 22, 122, 123, 20, 22, 122, 123, 100, 101, 50, 51, 151,
+    152, 100, 101, 100, 102, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 50, 51, 151, 152, 100, 101, 100, 101, 100, 102, 100, 101, 50,
+    52, 152, 153, 100, 102, 100, 101, 50, 52, 152, 153, 100, 101, 131, 132, 100,
+    101, 131, 132, 100, 101, 131, 132, 100, 101, 131, 132, 100, 101, 131, 132, 100,
+    101, 131, 132, 100, 101, 131, 132, 100, 101, 100, 101, 131, 132, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 60, 62, 162, 164, 100, 101, 100,
+    101, 60, 62, 162, 164, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    102, 152, 153, 100, 101, 100, 102, 152, 153, 100, 101, 60, 62, 162, 164, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 50, 52, 152, 153, 50, 52, 152, 153, 20, 22, 122, 123, 100, 101, 50,
+    52, 152, 153, 20, 22, 122, 123, 50, 52, 152, 153, 20, 22, 122, 123, 50,
+    52, 152, 153, 50, 52, 152, 153, 100, 101, 20, 22, 122, 123, 100, 101, 50,
+    51, 151, 152, 100, 102, 152, 153, 100, 102, 152, 153, 100, 102, 152, 153, 100,
+    102, 152, 153, 100, 101, 100, 101, 100, 101, 106, 107, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100,
+    101, 100, 101, 100, 101, 100, 101, 131, 132, 20, 21, 121, 122, 100, 101, 100,
+    101, 100, 101, 20, 21, 121, 122, 20, 21, 121, 122, 20, 21, 121, 122, 100,
+    101, 20, 21, 121, 122, 100, 101, 131, 132, 20, 21, 121, 122, 20, 21, 121,
+    122, 100, 101, 100, 101, 100, 101, 131, 132, 100, 101, 100, 101, 20, 21, 121,
+    122, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 20,
+    22, 122, 123, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 20,
+    22, 122, 123, 100, 101, 100, 101, 100, 101, 20, 22, 122, 123, 10, 11, 21,
+    22, 122, 123, 223, 224, 234, 235, 10, 11, 21, 22, 122, 123, 223, 224, 234,
+    235, 10, 11, 21, 22, 122, 123, 223, 224, 324, 325, 10, 11, 21, 22, 122,
+    123, 223, 224, 324, 325, 100, 102, 100, 101, 100, 101, 30, 31, 131, 132, 100,
+    102, 202, 203, 100, 101, 100, 101, 100, 101, 100, 102, 100, 101, 100, 102, 202,
+    203, 100, 102, 202, 203, 100, 102, 202, 203, 223, 224, 100, 102, 202, 203, 223,
+    224, 100, 102, 202, 203, 223, 224, 100, 102, 202, 203, 223, 224, 30, 31, 131,
+    132, 50, 51, 151, 152, 100, 102, 152, 153, 100, 101, 50, 51, 151, 152, 100,
+    102, 152, 153, 100, 102, 202, 203, 223, 224, 100, 101, 30, 31, 51, 53, 153,
+    154, 30, 31, 51, 53, 153, 154, 100, 101, 201, 202, 100, 101, 30, 31, 51,
+    53, 153, 154, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 100, 101, 111,
+    112, 100, 101, 100, 101, 20, 21, 61, 62, 122, 124, 224, 225, 100, 101, 30,
+    31, 41, 42, 62, 64, 164, 165, 100, 101, 111, 112, 20, 21, 61, 62, 122,
+    124, 224, 225, 20, 21, 61, 62, 122, 124, 224, 225, 100, 101, 100, 101, 111,
+    112, 100, 102, 202, 203, 100, 101, 100, 102, 202, 203, 223, 224, 100, 101, 100,
+    102, 202, 203, 223, 224, 100, 101, 100, 101, 111, 112, 100, 101, 20, 21, 61,
+    62, 122, 124, 224, 225, 20, 21, 61, 62, 122, 124, 224, 225, 100, 101, 111,
+    112, 30, 31, 41, 42, 62, 64, 164, 165, 100, 101, 100, 101, 111, 112, 30,
+    31, 41, 42, 62, 64, 164, 165, 100, 101, 100, 101, 100, 101, 100, 102, 202,
+    203, 100, 101, 20, 21, 61, 62, 122, 124, 224, 225, 100, 101, 20, 21, 61,
+    62, 122, 124, 224, 225, 100, 101, 100, 101, 100, 101, 100, 100,
+};
+
 inline constexpr Marker OBSIDIAN_FIELDLANDS[] = {
     { 0, 664.60f, 28.10f, 101.20f, 3, 0, 1, 1 },
     { 1, 350.04f, 27.63f, 487.96f, 3, 1, 1, 100 },
@@ -5169,6 +5477,30 @@ inline constexpr Marker OBSIDIAN_FIELDLANDS[] = {
 };
 inline constexpr size_t OBSIDIAN_FIELDLANDS_COUNT = 304;
 
+// group_id -> index into OBSIDIAN_FIELDLANDS, -1 if the region has no marker for it.
+inline constexpr int16_t OBSIDIAN_FIELDLANDS_BY_GROUP[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+    288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+};
+inline constexpr size_t OBSIDIAN_FIELDLANDS_BY_GROUP_COUNT = 304;
+
 inline constexpr Marker CRIMSON_MIRELANDS[] = {
     { 0, 383.69f, 42.45f, 575.15f, 3, 857, 1, 100 },
     { 1, 519.56f, 37.61f, 785.63f, 3, 858, 1, 100 },
@@ -5573,6 +5905,36 @@ inline constexpr Marker CRIMSON_MIRELANDS[] = {
 };
 inline constexpr size_t CRIMSON_MIRELANDS_COUNT = 400;
 
+// group_id -> index into CRIMSON_MIRELANDS, -1 if the region has no marker for it.
+inline constexpr int16_t CRIMSON_MIRELANDS_BY_GROUP[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+    288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+    304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+    320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+    336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+    352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+    368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
+    384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399,
+};
+inline constexpr size_t CRIMSON_MIRELANDS_BY_GROUP_COUNT = 400;
+
 inline constexpr Marker COBALT_COASTLANDS[] = {
     { 0, 245.24f, 27.33f, 705.15f, 3, 2052, 1, 100 },
     { 1, 202.90f, 27.90f, 553.00f, 3, 2053, 1, 100 },
@@ -5985,6 +6347,37 @@ inline constexpr Marker COBALT_COASTLANDS[] = {
 };
 inline constexpr size_t COBALT_COASTLANDS_COUNT = 408;
 
+// group_id -> index into COBALT_COASTLANDS, -1 if the region has no marker for it.
+inline constexpr int16_t COBALT_COASTLANDS_BY_GROUP[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+    288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+    304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+    320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+    336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+    352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+    368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
+    384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399,
+    400, 401, 402, 403, 404, 405, 406, 407,
+};
+inline constexpr size_t COBALT_COASTLANDS_BY_GROUP_COUNT = 408;
+
 inline constexpr Marker CORONET_HIGHLANDS[] = {
     { 0, 623.82f, 56.62f, 922.66f, 3, 3138, 1, 100 },
     { 1, 841.70f, 50.98f, 536.03f, 3, 3139, 1, 100 },
@@ -6251,6 +6644,28 @@ inline constexpr Marker CORONET_HIGHLANDS[] = {
 };
 inline constexpr size_t CORONET_HIGHLANDS_COUNT = 262;
 
+// group_id -> index into CORONET_HIGHLANDS, -1 if the region has no marker for it.
+inline constexpr int16_t CORONET_HIGHLANDS_BY_GROUP[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    256, 257, 258, 259, 260, 261,
+};
+inline constexpr size_t CORONET_HIGHLANDS_BY_GROUP_COUNT = 262;
+
 inline constexpr Marker ALABASTER_ICELANDS[] = {
     { 0, 578.90f, 30.50f, 640.40f, 3, 3932, 1, 100 },
     { 1, 671.23f, 34.68f, 558.91f, 3, 3933, 1, 100 },
@@ -6552,6 +6967,30 @@ inline constexpr Marker ALABASTER_ICELANDS[] = {
 };
 inline constexpr size_t ALABASTER_ICELANDS_COUNT = 297;
 
+// group_id -> index into ALABASTER_ICELANDS, -1 if the region has no marker for it.
+inline constexpr int16_t ALABASTER_ICELANDS_BY_GROUP[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+    288, 289, 290, 291, 292, 293, 294, 295, 296,
+};
+inline constexpr size_t ALABASTER_ICELANDS_BY_GROUP_COUNT = 297;
+
 inline constexpr RegionBounds BOUNDS[5] = {
     { 0.00f, 0.00f, 1024.00f, 1024.00f, 1024, 1024 },
     { 0.00f, 0.00f, 1024.00f, 1024.00f, 1024, 1024 },
@@ -6571,26 +7010,53 @@ inline const Marker* getMarkers(PlaRegion r, size_t& count) {
     }
 }
 
+inline const int16_t* getGroupIndex(PlaRegion r, size_t& count) {
+    switch (r) {
+        case PlaRegion::ObsidianFieldlands: count = OBSIDIAN_FIELDLANDS_BY_GROUP_COUNT; return OBSIDIAN_FIELDLANDS_BY_GROUP;
+        case PlaRegion::CrimsonMirelands:   count = CRIMSON_MIRELANDS_BY_GROUP_COUNT;   return CRIMSON_MIRELANDS_BY_GROUP;
+        case PlaRegion::CobaltCoastlands:   count = COBALT_COASTLANDS_BY_GROUP_COUNT;   return COBALT_COASTLANDS_BY_GROUP;
+        case PlaRegion::CoronetHighlands:   count = CORONET_HIGHLANDS_BY_GROUP_COUNT;   return CORONET_HIGHLANDS_BY_GROUP;
+        case PlaRegion::AlabasterIcelands:  count = ALABASTER_ICELANDS_BY_GROUP_COUNT;  return ALABASTER_ICELANDS_BY_GROUP;
+        default: count = 0; return nullptr;
+    }
+}
+
+// O(1): the marker for `groupId` in region `r`, or nullptr if it has none.
+inline const Marker* markerFor(PlaRegion r, int groupId) {
+    size_t n, count;
+    const int16_t* index = getGroupIndex(r, count);
+    if (groupId < 0 || (size_t)groupId >= count || index[groupId] < 0) return nullptr;
+    const Marker* ms = getMarkers(r, n);
+    return &ms[index[groupId]];
+}
+
 inline int findMarker(int groupId, const Marker*& outMarker) {
     for (int r = 0; r < (int)PlaRegion::Count; r++) {
-        size_t n; const Marker* ms = getMarkers((PlaRegion)r, n);
-        for (size_t i = 0; i < n; i++) {
-            if (ms[i].groupId == groupId) { outMarker = &ms[i]; return r; }
-        }
+        outMarker = markerFor((PlaRegion)r, groupId);
+        if (outMarker) return r;
     }
-    outMarker = nullptr;
     return -1;
 }
 
+// Resolve a raw 64-bit slot roll to a SlotEntry for this marker. The game's
+// roll is slotRaw / 2^64 * slotTotal; floor(slotRaw * slotTotal / 2^64) is
+// below an integer cumulative weight exactly when that real-valued roll is,
+// so the slot is the first cumulative weight above it.
+inline const SlotEntry* resolveSlotRaw(const Marker& m, uint64_t slotRaw) {
+    if (m.slotCount == 0 || m.slotTotal == 0) return nullptr;
+    uint32_t roll = (uint32_t)(((unsigned __int128)slotRaw * m.slotTotal) >> 64);
+    const uint16_t* cum = &SLOT_CUMULATIVE[m.slotOffset];
+    size_t i = std::upper_bound(cum, cum + m.slotCount, roll) - cum;
+    return &SLOTS[m.slotOffset + std::min<size_t>(i, m.slotCount - 1)];
+}
+
 // Resolve a slot roll [0, slotTotal) to a SlotEntry for this marker.
 inline const SlotEntry* resolveSlot(const Marker& m, double slotRoll) {
     if (m.slotCount == 0 || m.slotTotal == 0) return nullptr;
-    double acc = 0;
-    for (uint8_t i = 0; i < m.slotCount; i++) {
-        acc += SLOTS[m.slotOffset + i].weight;
-        if (slotRoll < acc) return &SLOTS[m.slotOffset + i];
-    }
-    return &SLOTS[m.slotOffset + m.slotCount - 1];
+    const uint16_t* cum = &SLOT_CUMULATIVE[m.slotOffset];
+    size_t i = std::upper_bound(cum, cum + m.slotCount, slotRoll,
+                                [](double r, uint16_t c) { return r < c; }) - cum;
+    return &SLOTS[m.slotOffset + std::min<size_t>(i, m.slotCount - 1)];
 }
 
 } // namespace PlaMarkers
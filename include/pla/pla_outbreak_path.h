@@ -0,0 +1,45 @@
+#pragma once
+#include "pla/pla_encounter.h"
+#include <cstddef>
+#include <cstdint>
+
+// Mass-outbreak path search: which sequence of "clear k Pokemon, let k
+// respawn" actions reaches a shiny before the outbreak runs out.
+//
+// RNG layout (PLA-Live-Map's aggressive outbreak path): the group seed
+// spawns the first INIT_SPAWNS Pokemon, then its next draw seeds the respawn
+// RNG. An action that clears k (1..MAX_CLEAR) spawns k replacements from the
+// respawn RNG, two draws each, and reseeds it from the following draw. The
+// outbreak holds spawnCount Pokemon in total, so at most spawnCount -
+// INIT_SPAWNS replacements are available.
+namespace PlaOutbreakPath {
+
+constexpr int INIT_SPAWNS = 4;
+constexpr int MAX_CLEAR   = 4;
+constexpr int MAX_ACTIONS = 15 - INIT_SPAWNS;  // every action respawns at least one
+
+// Outbreak spawns roll the shiny check this many extra times.
+constexpr int OUTBREAK_BONUS_ROLLS = 25;
+
+struct Options {
+    int shinyRolls = 1 + OUTBREAK_BONUS_ROLLS;
+    int threads    = 1;   // total threads including the caller
+};
+
+struct Result {
+    bool    found;
+    int     actions;              // 0 = one of the initial spawns is shiny
+    uint8_t path[MAX_ACTIONS];    // Pokemon cleared per action
+    int     spawnIndex;           // shiny's index among the last action's spawns
+                                  // (or the initial spawns)
+    PlaEncounter::Fixed pokemon;  // regular outbreak spawns: no guaranteed IVs
+    size_t  states;               // distinct RNG states expanded
+};
+
+// Shortest path to a shiny: fewest actions, then fewest Pokemon cleared, then
+// lexicographically smallest path. Breadth-first by action count, so the
+// first level with a hit settles it; identical (respawn seed, spawns left)
+// states are expanded once.
+Result search(uint64_t groupSeed, int spawnCount, const Options& options);
+
+} // namespace PlaOutbreakPath
@@ -1,9 +1,12 @@
 #pragma once
+#include "pla/pla_config.h"
 #include "pla/pla_encounter.h"
+#include "pla/pla_live_grid.h"
 #include "pla/pla_region.h"
+#include "pla/pla_shiny_search.h"
 #include "game_type.h"
+#include <algorithm>
 #include <cstdint>
-#include <vector>
 #include <string>
 
 // PLA pointers (game versions 1.1.0 and 1.1.1 - chains from
@@ -39,13 +42,17 @@ namespace PlaPointers {
     constexpr uint64_t SIZE_FIELD        = 0x18;     // size of 0x40-stride list
 }
 
+namespace PlaMarkers { struct Marker; }
+
+// Everything about one spawner, assembled on demand by PlaReader::detail()
+// for the rows and popups actually on screen.
 struct PlaSpawner {
     // Raw (region-independent)
     int       groupId;
     uint64_t  generatorSeed;
     uint64_t  groupSeed;           // generatorSeed - XOROSHIRO_CONST
 
-    // Decorated (filled by decorate() - depend on the selected PlaRegion)
+    // Decorated (depend on the region the table was decorated for)
     int       region;              // PlaRegion or -1 if no marker in selected region
     float     markerX, markerY, markerZ;
     uint8_t   guaranteedIvs;
@@ -59,11 +66,69 @@ struct PlaSpawner {
     bool        alpha;
 };
 
+// One entry per spawner group / live position; std::vector in the app, fixed
+// capacity in the overlay (pla_config.h).
+template <class T> using PlaGroupList = PlaConfig::List<T, PlaConfig::MAX_GROUPS>;
+using PlaPositionList = PlaConfig::List<PlaLivePos, PlaConfig::MAX_POSITIONS>;
+
+// Spawner list, one array per field. Filters, sorts, map dots and stats walk
+// only the columns they read; the wide per-spawner details (first-spawn IVs
+// and nature, live position, names) stay out of it and come from
+// PlaReader::detail(). Columns always have the same length.
+struct PlaSpawnerTable {
+    static constexpr uint8_t  ACTIVE    = 1 << 0;  // marker matches a live position
+    static constexpr uint8_t  SHINY_NOW = 1 << 1;  // first spawn is shiny
+    static constexpr uint8_t  ALPHA     = 1 << 2;
+    static constexpr uint16_t NO_SLOT   = 0xFFFF;
+
+    // Raw (region-independent)
+    PlaGroupList<int16_t>  groupId;
+    PlaGroupList<uint64_t> groupSeed;      // generatorSeed - XOROSHIRO_CONST
+
+    // Decorated (filled by decorate() - depend on the selected PlaRegion)
+    PlaGroupList<int8_t>   region;         // PlaRegion or -1 if no marker there
+    PlaGroupList<int32_t>  shinyAdvance;   // -1 = none within maxAdvance
+    PlaGroupList<uint8_t>  flags;
+    PlaGroupList<float>    markerX, markerZ;
+    PlaGroupList<uint16_t> speciesId;      // national dex id; 0 if unresolved
+    PlaGroupList<uint16_t> slot;           // index into PlaMarkers::SLOTS, or NO_SLOT
+    int shinyRolls = 1;                    // rolls the decorated columns are for
+
+    size_t size() const { return groupId.size(); }
+    bool active(size_t i) const   { return flags[i] & ACTIVE; }
+    bool shinyNow(size_t i) const { return flags[i] & SHINY_NOW; }
+    bool alpha(size_t i) const    { return flags[i] & ALPHA; }
+
+    void clear();
+    void reserve(size_t n);
+    // Append a scanned spawner; its decorated columns start out undecorated.
+    void pushRaw(int groupId, uint64_t groupSeed);
+};
+
 struct PlaOutbreak {
     bool     present;
     int      groupId;
     uint64_t groupSeed;
     uint8_t  spawnCount;           // 10..15 typical
+
+    bool operator==(const PlaOutbreak& o) const {
+        return present == o.present && groupId == o.groupId &&
+               groupSeed == o.groupSeed && spawnCount == o.spawnCount;
+    }
+};
+
+// Per-region summary of a decorated scan (species-resolved spawners only).
+struct PlaRegionStats {
+    size_t current;   // shiny on the first spawn
+    size_t near;      // shiny within nearThreshold advances
+    size_t total;
+};
+
+// Raw result of one tracking poll: group seeds plus the live-position list.
+struct PlaScan {
+    PlaSpawnerTable spawners;            // raw columns only; decorate() fills the rest
+    PlaPositionList livePositions;
+    PlaOutbreak outbreak{};              // re-read with every poll
 };
 
 class PlaReader {
@@ -74,18 +139,110 @@ public:
     bool readLive(int maxGroups = 256);
 
     // Re-interpret the raw spawner list against a specific region's markers.
-    // Populates species/shiny/active fields. Cheap: just per-spawner RNG, no I/O.
+    // Populates the species/shiny/active columns. No I/O; the shiny search is
+    // memoised per group seed, so re-decorating after a tab switch, a
+    // roll-count change, a rescan or a tracking poll only searches spawners
+    // whose seed is new. The first spawn itself is left to detail().
     void decorate(PlaRegion region, int shinyRolls = 1, int maxAdvance = 5000);
 
+    // Threads for the batched shiny search behind decorate()/decorateAll()
+    // (PlaShinySearch). Defaults to 1 for the overlay's single core.
+    void setSearchThreads(int threads) { searchThreads_ = threads; }
+
+    // Decorate the current scan for all five regions and keep the results:
+    // per region, the spawners that have a marker there (decorated for that
+    // region) and their summary stats. Valid until the next readLive() or
+    // applyScan(); spawners() is left untouched.
+    void decorateAll(int shinyRolls = 1, int maxAdvance = 5000, int nearThreshold = 100);
+    const PlaSpawnerTable& regionSpawners(PlaRegion region) const {
+        return regions_[(int)region].spawners;
+    }
+    PlaRegionStats regionStats(PlaRegion region) const { return regions_[(int)region].stats; }
+
+    // Tracking. Re-read generator seeds, live positions and the outbreak (same
+    // bulk read as readLive) and compare them with the previous scan; returns
+    // false when nothing changed. Only touches tracking state, so it may run on a worker
+    // thread; hand the result to applyScan() on the thread that decorates.
+    bool pollLive(PlaScan& out, int maxGroups = 256);
+    // Replace the raw spawner list with a polled scan. Call decorate() after.
+    void applyScan(PlaScan&& scan);
+
+    // Outbreak slots plus the active group. Reads into the same buffer as
+    // readLive()/pollLive(), so only call it from the thread that owns memory
+    // reads - not while a watch thread is polling. In live mode use
+    // PlaScan::outbreak instead.
     PlaOutbreak readOutbreak();
 
     // Write the player's world position. Returns true on success.
     static bool teleport(float x, float y, float z);
 
-    const std::vector<PlaSpawner>& spawners() const { return spawners_; }
+    const PlaSpawnerTable& spawners() const { return spawners_; }
+
+    // Full record for row i of spawners() or of a regionSpawners() table:
+    // the columns plus the first spawn, marker height and live position.
+    // Meant for the handful of rows on screen; valid for the same scan.
+    PlaSpawner detail(const PlaSpawnerTable& table, size_t i) const;
+    PlaSpawner detail(size_t i) const { return detail(spawners_, i); }
 
 private:
-    std::vector<PlaSpawner> spawners_;
-    struct LivePos { float x, y, z; };
-    std::vector<LivePos> livePositions_;
+    PlaSpawnerTable spawners_;
+    PlaPositionList livePositions_;
+    PlaLiveGrid liveGrid_;  // over livePositions_; rebuilt by readLive/applyScan
+
+    // A marker is active when a live position lies within this many world units.
+    static constexpr float ACTIVE_RADIUS = 25.0f;
+
+    struct RegionCache {
+        PlaSpawnerTable spawners;
+        PlaRegionStats stats{};
+    };
+    RegionCache regions_[(int)PlaRegion::Count];
+    void clearRegionCache();
+
+    // Tracking snapshot (pollLive only): generator seed per group id and the
+    // live-position list from the previous scan, plus the reused read buffer.
+    PlaGroupList<uint64_t> trackedSeeds_;
+    PlaPositionList trackedPositions_;
+    PlaOutbreak trackedOutbreak_{};
+    // Bulk-read buffer: one span covers the position list and the group array.
+    static constexpr size_t SCAN_SPAN =
+        std::max(PlaPointers::POS_POSITION + PlaConfig::MAX_GROUPS * PlaPointers::GROUP_STRIDE,
+                 PlaPointers::POS_SEED + PlaConfig::MAX_POSITIONS * PlaPointers::POS_STRIDE + 8);
+    PlaConfig::List<uint8_t, SCAN_SPAN> scanBuf_;
+
+    // Memoised per group seed. The shiny walk is the expensive part of
+    // decorating and its table answers every roll count, so changing rolls
+    // never re-walks a seed.
+    struct ShinyKey {
+        uint64_t groupSeed;
+        int      maxAdvance;
+        bool operator==(const ShinyKey& o) const {
+            return groupSeed == o.groupSeed && maxAdvance == o.maxAdvance;
+        }
+    };
+    struct ShinyKeyHash {
+        size_t operator()(const ShinyKey& k) const {
+            return (size_t)(k.groupSeed ^ ((uint64_t)k.maxAdvance << 32));
+        }
+    };
+    // Bounded: cleared when full.
+    static constexpr size_t SHINY_MEMO_MAX = PlaConfig::SHINY_MEMO_MAX;
+    PlaConfig::Memo<ShinyKey, PlaEncounter::ShinyTable, ShinyKeyHash> shinyMemo_;
+
+    int searchThreads_ = 1;
+    // primeShinyTables scratch
+    PlaGroupList<PlaShinySearch::Job> primeJobs_;
+    PlaGroupList<PlaEncounter::ShinyTable> primeTables_;
+
+    const PlaEncounter::ShinyTable& shinyTable(uint64_t groupSeed, int maxAdvance);
+    // Walk every spawner seed missing from shinyMemo_ in one batched search,
+    // so the decorateRow() calls that follow only hit.
+    void primeShinyTables(int maxAdvance);
+    void decorateRow(PlaSpawnerTable& t, size_t i, PlaRegion region,
+                     const PlaMarkers::Marker* m, int maxAdvance);
+    // Bulk read behind readLive() and pollLive(); also fills `outbreak` when
+    // given, from the same span.
+    bool scan(int maxGroups, PlaSpawnerTable& spawners,
+              PlaPositionList& positions, PlaGroupList<uint64_t>& seeds,
+              PlaOutbreak* outbreak = nullptr);
 };
@@ -0,0 +1,60 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// Visiting order for a shiny hunt across one region's spawners.
+//
+// Stops are marker positions (x/z plane) plus the advances each spawner still
+// needs. The route is an open path from a start point: nearest-neighbour
+// construction over a grid of the stops, then 2-opt and Or-opt moves limited
+// to each stop's nearest neighbours and driven by don't-look bits. update()
+// applies a changed stop set by splicing out consumed stops and inserting new
+// ones at their cheapest position, then only re-optimises around the stops it
+// touched, so ticking spawners off one at a time stays cheap.
+class PlaRoutePlanner {
+public:
+    struct Stop {
+        int   id;          // caller's handle (group id)
+        float x, z;
+        int   advances;    // respawns needed before it is shiny (0 = now)
+    };
+
+    // Travel-equivalent cost of one advance (world units). Every stop's
+    // advances are paid whatever the order, so this only shapes cost(), which
+    // the caller can compare across regions or stop sets.
+    float advanceCost = 20.0f;
+
+    // Build a route from scratch. Up to a few hundred stops.
+    void plan(const std::vector<Stop>& stops, float startX, float startZ);
+    // Re-plan incrementally for a new stop set (matched by id); positions and
+    // advances of kept stops are refreshed. Same start point as plan().
+    void update(const std::vector<Stop>& stops);
+    void clear();
+
+    // Stops in visiting order (the start point excluded).
+    std::vector<Stop> route() const;
+    float travel() const;      // path length from the start point
+    float cost() const;        // travel() + advanceCost * total advances
+
+private:
+    static constexpr int NEIGHBOURS = 8;    // candidate list size per stop
+
+    // Node 0 is the fixed start point; route_[0] is always 0.
+    std::vector<Stop> nodes_;
+    std::vector<int> route_;               // node per position
+    std::vector<int> pos_;                 // position per node
+    std::vector<int> neighbours_;          // NEIGHBOURS nearest nodes per node (-1 pads)
+    std::vector<uint8_t> active_;          // don't-look bits (1 = look again)
+    std::vector<int> queue_;
+
+    float dist(int a, int b) const;
+    float edge(int posA, int posB) const;  // 0 when posB is past the end
+    void buildNeighbours();
+    void nearestNeighbourTour();
+    void insertCheapest(int node);
+    void activate(int node);
+    void improve();
+    bool tryTwoOpt(int node);
+    bool tryOrOpt(int node);
+    void reindex();
+};
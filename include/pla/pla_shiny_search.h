@@ -0,0 +1,50 @@
+#pragma once
+#include "pla/pla_encounter.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Batch shiny search over many spawners at once.
+//
+// Every advance reseeds a group RNG from its own output, so one spawner is
+// inherently serial; independent spawners are the unit of parallelism. Each
+// of `threads` workers walks 4 jobs in lockstep, one advance per job per step
+// so the serial chains overlap in the pipeline, and refills a finished lane
+// from a shared counter. Each walk stops as soon as it has `firstK` hits, so
+// a deep maxAdvance only costs anything for the rare seed with no shiny
+// nearby. The walk only needs EC/TID/PID, so IVs and nature are never
+// generated and the result depends on the group seed and roll count alone.
+namespace PlaShinySearch {
+
+constexpr int MAX_HITS = 4;
+
+struct Job {
+    uint64_t groupSeed;
+    int      shinyRolls;
+};
+
+struct Hits {
+    int      count;                 // number of advances found (<= firstK)
+    uint32_t advance[MAX_HITS];     // ascending; 0 = current init spawn
+};
+
+struct Options {
+    uint32_t maxAdvance = 1000000;  // inclusive, like nextShiny's maxAdvance
+    int      firstK     = 1;        // stop a job after this many hits (1..MAX_HITS)
+    int      threads    = 1;        // total threads including the caller
+    // Polled between advances; when set, run() returns early and unfinished
+    // jobs keep whatever hits they had.
+    const std::atomic<bool>* cancel = nullptr;
+};
+
+// Same answer as PlaEncounter::nextShiny(groupSeed, rolls, ivs, true, maxAdvance)
+// for firstK = 1 (advance[0], or count = 0 for -1). Blocks until done;
+// extra threads are moved to spare cores 1.., the caller stays where it is.
+void run(const Job* jobs, size_t count, const Options& options, Hits* out);
+
+// ShinyTable for each group seed (every roll count in one walk; matches
+// PlaEncounter::shinyTable). Job::shinyRolls and Options::firstK are unused.
+void runTables(const Job* jobs, size_t count, const Options& options,
+               PlaEncounter::ShinyTable* out);
+
+} // namespace PlaShinySearch
@@ -9,6 +9,7 @@
 #include "swish_crypto.h"
 #include <vector>
 #include <string>
+#include <mutex>
 
 // Complete raid info for display
 struct RaidInfo {
@@ -21,38 +22,99 @@ struct RaidInfo {
     std::vector<RewardItem> rewards;
 };
 
+// One slot's new state, produced by RaidReader::pollLive(). `present` is false
+// when the slot no longer holds a supported raid (emptied, event raid, ...).
+struct RaidPatch {
+    int slotIndex;
+    bool present;
+    RaidInfo info;
+};
+
+// Wall time spent loading one on-demand resource (encounter table, location
+// file, reward tables). Recorded once per resource, in load order.
+struct ResourceLoadTime {
+    std::string name;
+    uint32_t    micros;
+    bool        ok;
+};
+
 class RaidReader {
 public:
-    // Load all static data (encounter tables, personal data, locations)
+    // Load personal data and remember dataDir. Encounter tables, locations and
+    // reward tables are loaded on demand the first time a map needs them.
     bool loadResources(const std::string& dataDir);
 
+    // Load everything a map needs (both encounter tables + locations + rewards).
+    // Thread-safe; each resource is loaded at most once.
+    void ensureMapLoaded(TeraRaidMapParent map);
+
     // Process a save file and extract all active raids
     bool readSave(const std::string& savePath, GameVersion version);
 
     // Read raids from live game memory via dmntcht (applet mode)
     bool readLive(GameVersion version);
 
+    // Live watch. Re-read both raid blocks and compare them with the snapshot
+    // from the previous readLive()/pollLive() per 0x20-byte slot; only changed
+    // slots are decoded again, into `out`. Returns false when nothing changed.
+    // Does not touch raids(), so it may run on a worker thread while the UI
+    // draws; hand the result to applyPatches() on the UI thread.
+    bool pollLive(GameVersion version, std::vector<RaidPatch>& out);
+    void applyPatches(const std::vector<RaidPatch>& patches);
+
     const std::vector<RaidInfo>& raids() const { return raids_; }
     GameProgress progress() const { return progress_; }
     uint32_t trainerID32() const { return id32_; }
 
+    // Per-resource load timings so far (copy; safe while loads are in flight).
+    std::vector<ResourceLoadTime> loadTimings() const;
+    bool writeLoadReport(const std::string& path) const;
+
 private:
+    static constexpr int MAP_COUNT = 3;
+
+    std::string dataDir_;
     PersonalTable personal_;
     LocationData locations_;
 
-    EncounterTable paldeaStandard_;
-    EncounterTable paldeaBlack_;
-    EncounterTable kitakamiStandard_;
-    EncounterTable kitakamiBlack_;
-    EncounterTable blueberryStandard_;
-    EncounterTable blueberryBlack_;
+    // Indexed [map][isBlack]
+    EncounterTable tables_[MAP_COUNT][2];
     RewardCalc rewardCalc_;
 
-    std::vector<RaidInfo> raids_;
+    std::once_flag tableOnce_[MAP_COUNT][2];
+    std::once_flag locationOnce_[MAP_COUNT];
+    std::once_flag rewardOnce_;
+
+    mutable std::mutex timingsMutex_;
+    std::vector<ResourceLoadTime> timings_;
+
+    std::vector<RaidInfo> raids_;  // sorted by slotIndex
     GameProgress progress_ = GameProgress::Beginning;
     uint32_t id32_ = 0;
 
+    // Live-mode snapshot: where the raid blocks were found and their last bytes.
+    // Polls read the cached addresses directly and only walk the pointer
+    // chains again every RESOLVE_EVERY polls or after a failed read.
+    static constexpr int RESOLVE_EVERY = 10;
+    uint64_t paldeaAddr_ = 0, dlcAddr_ = 0;
+    std::vector<uint8_t> paldeaRaw_, dlcRaw_;
+    std::vector<uint8_t> pollPaldea_, pollDlc_;
+    int pollCount_ = 0;
+
+    bool resolveLiveBlocks();
+    bool readLiveBlocks(std::vector<uint8_t>& paldea, std::vector<uint8_t>& dlc);
+    void diffSlots(const uint8_t* before, const uint8_t* after, int count,
+                   TeraRaidMapParent map, GameVersion version, int startIndex,
+                   std::vector<RaidPatch>& out);
+
     void processSlots(const std::vector<TeraRaidDetail>& slots,
                       TeraRaidMapParent map, GameVersion version,
                       int startIndex);
+    bool processSlot(const TeraRaidDetail& slot, TeraRaidMapParent map,
+                     GameVersion version, int slotIndex, RaidInfo& info);
+
+    const EncounterTable& encounterTable(TeraRaidMapParent map, bool black);
+    void ensureLocations(TeraRaidMapParent map);
+    void ensureRewards();
+    void recordTiming(const std::string& name, uint32_t micros, bool ok);
 };
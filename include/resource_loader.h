@@ -0,0 +1,55 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+// Background loader for startup resources.
+//
+// A single worker thread runs queued jobs in FIFO order: parsing data files
+// and decoding images into SDL_Surfaces. Texture creation stays on the UI
+// thread (the renderer is not thread-safe), so callers take the decoded
+// surface and upload it themselves. Anything not ready yet is waited on.
+class ResourceLoader {
+public:
+    ResourceLoader() = default;
+    ~ResourceLoader();
+
+    ResourceLoader(const ResourceLoader&) = delete;
+    ResourceLoader& operator=(const ResourceLoader&) = delete;
+
+    // Queue a job. The worker is started on first use.
+    std::shared_future<void> enqueue(std::function<void()> job);
+
+    // Queue an image decode. No-op if the path is already queued.
+    // prefetchImage/takeImage are meant to be called from the UI thread only.
+    void prefetchImage(const std::string& path);
+
+    // Wait for a queued decode and take ownership of the surface (caller frees).
+    // If the path was never queued it is decoded synchronously.
+    SDL_Surface* takeImage(const std::string& path);
+
+    // Drain outstanding jobs, join the worker and free untaken surfaces.
+    void shutdown();
+
+private:
+    struct ImageSlot {
+        std::shared_future<void> ready;
+        SDL_Surface* surface = nullptr;
+    };
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::packaged_task<void()>> jobs_;
+    std::unordered_map<std::string, std::shared_ptr<ImageSlot>> images_;
+    std::thread worker_;
+    bool stopping_ = false;
+
+    void workerLoop();
+};
@@ -21,6 +21,33 @@ public:
     static uint16_t getTeraShardId(uint8_t teraType);
     static uint16_t getMaterialId(uint16_t species);
 
+    // Lottery roll count for `stars` from the seed's first nextInt(100).
+    static int getRewardCount(uint64_t random, int stars) {
+        // Reward roll count by star rating (from RewardUtil.cs)
+        static constexpr int REWARD_SLOTS[7][5] = {
+            {4, 5, 6, 7, 8},   // 1-star
+            {4, 5, 6, 7, 8},   // 2-star
+            {5, 6, 7, 8, 9},   // 3-star
+            {5, 6, 7, 8, 9},   // 4-star
+            {6, 7, 8, 9, 10},  // 5-star
+            {7, 8, 9, 10, 11}, // 6-star
+            {7, 8, 9, 10, 11}, // 7-star (mighty)
+        };
+        int idx = stars - 1;
+        if (idx < 0) idx = 0;
+        if (idx > 6) idx = 6;
+        if (random < 10) return REWARD_SLOTS[idx][0];
+        if (random < 40) return REWARD_SLOTS[idx][1];
+        if (random < 70) return REWARD_SLOTS[idx][2];
+        if (random < 90) return REWARD_SLOTS[idx][3];
+        return REWARD_SLOTS[idx][4];
+    }
+
+    // Rare item IDs: Herba Mystica, Ability Patch, Ability Capsule, Bottle Cap, Gold Bottle Cap
+    static bool isRareItem(uint16_t id) {
+        return (id >= 1904 && id <= 1908) || id == 1606 || id == 645 || id == 795 || id == 796;
+    }
+
 private:
     struct FixedEntry {
         uint8_t  category;
@@ -43,6 +70,4 @@ private:
 
     std::unordered_map<uint64_t, std::vector<FixedEntry>> fixedTables_;
     std::unordered_map<uint64_t, LotteryTable> lotteryTables_;
-
-    static int getRewardCount(uint64_t random, int stars);
 };
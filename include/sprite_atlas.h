@@ -0,0 +1,48 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Packed sprite sheets generated by tools/pack_sprite_atlas.py.
+//
+// romfs/atlas/sprites.bin maps (species, form) to a rect on one of a few
+// sprites_N.png sheets, so every sprite draws from a handful of textures
+// via source rects instead of one texture per species.
+class SpriteAtlas {
+public:
+    static constexpr uint32_t MAGIC = 0x54415053;  // 'SPAT'
+    static constexpr uint16_t VERSION = 1;
+
+    struct Entry {
+        uint16_t species;
+        uint8_t  form;
+        uint8_t  sheet;
+        uint16_t x, y, w, h;
+    };
+
+    ~SpriteAtlas() { free(); }
+
+    // Parse the index. Sheets are attached separately with setSheet().
+    bool loadIndex(const std::string& path);
+    bool hasIndex() const { return !entries_.empty(); }
+
+    int sheetCount() const { return (int)sheets_.size(); }
+    static std::string sheetPath(const std::string& dir, int index);
+
+    // Takes ownership of the texture.
+    void setSheet(int index, SDL_Texture* tex);
+    bool hasSheet(int index) const { return sheets_[index] != nullptr; }
+
+    // Look up a sprite; form-specific entries win, else the base form.
+    // Returns false if neither is packed or its sheet failed to load.
+    bool find(uint16_t species, uint8_t form, SDL_Texture*& tex, SDL_Rect& src) const;
+
+    void free();
+
+private:
+    std::vector<Entry> entries_;  // sorted by (species, form)
+    std::vector<SDL_Texture*> sheets_;
+
+    const Entry* lookup(uint16_t species, uint8_t form) const;
+};
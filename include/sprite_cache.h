@@ -0,0 +1,47 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Fallback for sprites the atlas does not cover: loose PNGs from a folder,
+// loaded synchronously on first draw. Normally nothing reaches it, so it stays
+// small: at most MAX_TEXTURES resident textures (least recently drawn evicted)
+// and MAX_MISSING remembered misses, so a list of unknown species neither
+// grows it without bound nor probes the SD card every frame.
+class SpriteCache {
+public:
+    static constexpr size_t MAX_TEXTURES = 32;
+    static constexpr size_t MAX_MISSING  = 256;
+
+    explicit SpriteCache(std::string dir) : dir_(std::move(dir)) {}
+    ~SpriteCache() { clear(); }
+
+    SpriteCache(const SpriteCache&) = delete;
+    SpriteCache& operator=(const SpriteCache&) = delete;
+
+    // Texture for (species, form): "NNN-F.png" first, then "NNN.png".
+    // nullptr if neither exists.
+    SDL_Texture* get(SDL_Renderer* renderer, uint16_t species, uint8_t form);
+
+    void clear();
+
+private:
+    struct Entry {
+        uint32_t key;
+        SDL_Texture* tex;
+    };
+
+    std::string dir_;
+    std::vector<Entry> resident_;    // most recently drawn first
+    std::vector<uint32_t> missing_;  // ring; the oldest miss is forgotten first
+    size_t missingNext_ = 0;
+
+    static uint32_t makeKey(uint16_t species, uint8_t form) {
+        return (uint32_t)species | ((uint32_t)form << 16);
+    }
+    SDL_Texture* load(SDL_Renderer* renderer, uint16_t species, uint8_t form) const;
+    void rememberMissing(uint32_t key);
+};
@@ -0,0 +1,79 @@
+#pragma once
+#include "dmnt_mem.h"
+#include "fixed_capacity.h"
+#include "game_type.h"
+#include "raid_calc.h"
+#include "tera_raid.h"
+#include "sv/sv_raid_tables.h"
+#include <cstddef>
+#include <cstdint>
+
+// Trimmed SV raid core for the overlay.
+//
+// RaidReader (the app) loads every encounter table, the personal table,
+// locations and reward tables from romfs and builds a full RaidInfo per slot.
+// This core answers only what the overlay shows - which encounter, tera type,
+// shiny state and how many rare rewards - from the compact tables compiled
+// into sv_raid_tables.h, which carry just the encounter fields, personal
+// types and reward tables those need. Slot decoding works straight off the
+// raw raid blocks into fixed-size storage, so a read touches no files and
+// allocates nothing. Results match RaidReader's for the same slot.
+struct SvRaid {
+    const SvRaidTables::Encounter* encounter;
+    uint32_t          seed;
+    uint16_t          slotIndex;   // as RaidInfo::slotIndex
+    TeraRaidMapParent map;
+    bool              black;
+    uint8_t           stars;
+    uint8_t           teraType;
+    TeraShiny         shiny;
+    uint8_t           rareCount;   // rare reward entries (RewardCalc::isRareItem)
+    uint16_t          rareItem;    // first of them; 0 = none
+};
+
+struct SvMapStats {
+    size_t total = 0;
+    size_t shiny = 0;
+    size_t black = 0;
+    size_t rare  = 0;   // raids with at least one rare reward
+};
+
+class SvRaidCore {
+public:
+    static constexpr int PALDEA_SLOTS    = 72;
+    static constexpr int KITAKAMI_SLOTS  = 100;
+    static constexpr int BLUEBERRY_SLOTS = 80;
+    static constexpr int MAX_RAIDS = PALDEA_SLOTS + KITAKAMI_SLOTS + BLUEBERRY_SLOTS;
+
+    // Read both raid blocks and MyStatus via dmnt:cht and decode them.
+    // Progress is assumed post-game, as in RaidReader::readLive().
+    bool readLive(GameVersion version);
+
+    // Decode raw raid blocks (RaidBlockData layout) into raids(). Returns the
+    // number of supported raids; event raids are skipped as in the app.
+    size_t parse(const uint8_t* paldea, size_t paldeaLen,
+                 const uint8_t* dlc, size_t dlcLen,
+                 GameVersion version, GameProgress progress, uint32_t id32);
+
+    // One slot; false when it holds no supported raid.
+    static bool resolve(const TeraRaidDetail& slot, TeraRaidMapParent map,
+                        GameVersion version, GameProgress progress, uint32_t id32,
+                        SvRaid& out);
+
+    const FixedVector<SvRaid, MAX_RAIDS>& raids() const { return raids_; }
+    SvMapStats mapStats(TeraRaidMapParent map) const;
+
+    // Indices into raids() of the map's best raids, best first: shiny, then
+    // rare reward count, then stars. Writes at most `max`; returns the count.
+    size_t topRaids(TeraRaidMapParent map, int* out, size_t max) const;
+
+private:
+    uint8_t paldeaRaw_[DmntPointers::KTeraRaidPaldeaSize];
+    uint8_t dlcRaw_[DmntPointers::KTeraRaidDLCSize];
+    uint8_t statusRaw_[DmntPointers::KMyStatusSize];
+    FixedVector<SvRaid, MAX_RAIDS> raids_;
+
+    void parseSlots(const uint8_t* base, int count, TeraRaidMapParent map,
+                    GameVersion version, GameProgress progress, uint32_t id32,
+                    int startIndex);
+};
@@ -0,0 +1,977 @@
+#pragma once
+// Auto-generated by tools/convert_sv_raid_tables.py — do not edit manually.
+// Source: romfs/data encounter_gem_*.pkl, personal_sv, reward_*.bin and the
+// species/types/items name lists.
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace SvRaidTables {
+
+// One EncounterTeraTF9, trimmed to what SvRaidCore reads.
+struct Encounter {
+    const char* name;
+    uint16_t species;
+    uint8_t  form;
+    uint8_t  stars;
+    uint8_t  randRate;
+    uint8_t  shiny;          // ShinyType
+    uint8_t  gem;            // GemType
+    uint8_t  type1, type2;   // personal types, for GemType::Default
+    int16_t  randRateMinScarlet;
+    int16_t  randRateMinViolet;
+    int16_t  fixedTable;     // index into FIXED_TABLES, -1 = none
+    int16_t  lotteryTable;   // index into LOTTERY_TABLES, -1 = none
+};
+
+struct Range { uint16_t offset, count; };
+
+// Lottery rolls walk the items by rate; itemId 0 is a tera shard or
+// material, resolved from the raid in the app.
+struct LotteryTable { uint16_t totalRate, offset, count; };
+struct LotteryItem  { uint16_t itemId, rate; };
+
+struct ItemName { uint16_t id; const char* name; };
+
+inline constexpr Encounter ENCOUNTERS[] = {
+    { "Pikachu", 25, 0, 3, 100, 0, 1, 12, 12, 0, 0, 0, 0 },
+    { "Pikachu", 25, 0, 2, 100, 0, 1, 12, 12, 0, 0, 1, 1 },
+    { "Raichu", 26, 0, 5, 100, 0, 1, 12, 12, 0, 0, 2, 2 },
+    { "Raichu", 26, 0, 4, 100, 0, 1, 12, 12, 0, 0, 3, 3 },
+    { "Jigglypuff", 39, 0, 2, 100, 0, 1, 0, 17, 100, 100, 4, 4 },
+    { "Wigglytuff", 40, 0, 4, 100, 0, 1, 0, 17, 100, 100, 5, 5 },
+    { "Venonat", 48, 0, 1, 100, 0, 1, 6, 3, 200, 200, 6, 6 },
+    { "Venomoth", 49, 0, 3, 100, 0, 1, 6, 3, 100, 100, 7, 7 },
+    { "Diglett", 50, 0, 2, 100, 0, 1, 4, 4, 200, 200, 1, 1 },
+    { "Dugtrio", 51, 0, 4, 100, 0, 1, 4, 4, 200, 200, 3, 3 },
+    { "Meowth", 52, 0, 2, 100, 0, 1, 0, 0, 300, 300, 1, 1 },
+    { "Persian", 53, 0, 4, 100, 0, 1, 0, 0, 300, 300, 3, 3 },
+    { "Psyduck", 54, 0, 2, 100, 0, 1, 10, 10, 400, 400, 8, 8 },
+    { "Golduck", 55, 0, 4, 100, 0, 1, 10, 10, 400, 400, 9, 9 },
+    { "Mankey", 56, 0, 2, 100, 0, 1, 1, 1, 500, 500, 10, 10 },
+    { "Primeape", 57, 0, 4, 100, 0, 1, 1, 1, 500, 500, 11, 11 },
+    { "Growlithe", 58, 0, 2, 100, 0, 1, 9, 9, 600, 600, 10, 10 },
+    { "Arcanine", 59, 0, 5, 100, 0, 1, 9, 9, 100, 100, 12, 12 },
+    { "Slowpoke", 79, 0, 2, 100, 0, 1, 10, 13, 700, 700, 4, 4 },
+    { "Slowbro", 80, 0, 5, 100, 0, 1, 10, 13, 200, 200, 13, 13 },
+    { "Magnemite", 81, 0, 2, 100, 0, 1, 12, 8, 4700, 4800, 8, 8 },
+    { "Magneton", 82, 0, 4, 100, 0, 1, 12, 8, 600, 600, 9, 9 },
+    { "Grimer", 88, 0, 2, 100, 0, 1, 3, 3, 4800, 4900, 14, 14 },
+    { "Muk", 89, 0, 4, 100, 0, 1, 3, 3, 700, 700, 15, 15 },
+    { "Shellder", 90, 0, 2, 100, 0, 1, 10, 10, 4900, 5000, 16, 16 },
+    { "Shellder", 90, 0, 1, 100, 0, 1, 10, 10, 5200, 5200, 17, 17 },
+    { "Cloyster", 91, 0, 5, 100, 0, 1, 10, 14, 300, 300, 13, 13 },
+    { "Cloyster", 91, 0, 4, 100, 0, 1, 10, 14, 800, 800, 18, 18 },
+    { "Gastly", 92, 0, 2, 100, 0, 1, 7, 3, 800, 800, 8, 8 },
+    { "Haunter", 93, 0, 3, 100, 0, 1, 7, 3, 200, 200, 7, 7 },
+    { "Gengar", 94, 0, 5, 100, 0, 1, 7, 3, 700, 700, 19, 19 },
+    { "Drowzee", 96, 0, 1, 100, 0, 1, 13, 13, 5500, 5500, 20, 20 },
+    { "Hypno", 97, 0, 4, 100, 0, 1, 13, 13, 6200, 6200, 15, 15 },
+    { "Voltorb", 100, 0, 2, 100, 0, 1, 12, 12, 900, 900, 1, 1 },
+    { "Electrode", 101, 0, 4, 100, 0, 1, 12, 12, 900, 900, 3, 3 },
+    { "Chansey", 113, 0, 3, 100, 0, 1, 0, 0, 600, 600, 21, 21 },
+    { "Scyther", 123, 0, 5, 100, 0, 1, 6, 2, 400, 400, 12, 12 },
+    { "Scyther", 123, 0, 4, 100, 0, 1, 6, 2, 1000, 1000, 11, 11 },
+    { "Tauros", 128, 1, 4, 100, 0, 1, 1, 1, 6000, 6000, 11, 11 },
+    { "Tauros", 128, 2, 5, 100, 0, 1, 1, 9, 7800, -1, 12, 12 },
+    { "Tauros", 128, 3, 5, 100, 0, 1, 1, 10, -1, 7800, 12, 12 },
+    { "Magikarp", 129, 0, 3, 100, 0, 1, 10, 10, 400, 400, 0, 0 },
+    { "Magikarp", 129, 0, 2, 100, 0, 1, 10, 10, 1000, 1000, 1, 1 },
+    { "Gyarados", 130, 0, 5, 100, 0, 1, 10, 2, 500, 500, 12, 12 },
+    { "Ditto", 132, 0, 5, 100, 0, 1, 0, 0, 800, 800, 2, 2 },
+    { "Ditto", 132, 0, 4, 100, 0, 1, 0, 0, 6300, 6300, 5, 5 },
+    { "Ditto", 132, 0, 3, 100, 0, 1, 0, 0, 300, 300, 21, 21 },
+    { "Eevee", 133, 0, 5, 100, 0, 1, 0, 0, 600, 600, 22, 22 },
+    { "Eevee", 133, 0, 3, 100, 0, 1, 0, 0, 500, 500, 23, 23 },
+    { "Dratini", 147, 0, 3, 100, 0, 1, 15, 15, 700, 700, 24, 24 },
+    { "Dragonair", 148, 0, 4, 100, 0, 1, 15, 15, 1100, 1100, 11, 11 },
+    { "Dragonite", 149, 0, 5, 100, 0, 1, 15, 2, 900, 900, 12, 12 },
+    { "Pichu", 172, 0, 1, 100, 0, 1, 12, 12, 0, 0, 25, 25 },
+    { "Igglybuff", 174, 0, 1, 100, 0, 1, 0, 17, 100, 100, 26, 26 },
+    { "Mareep", 179, 0, 2, 100, 0, 1, 12, 12, 1100, 1100, 8, 8 },
+    { "Flaaffy", 180, 0, 3, 100, 0, 1, 12, 12, 800, 800, 21, 21 },
+    { "Ampharos", 181, 0, 4, 100, 0, 1, 12, 12, 8500, 8400, 9, 9 },
+    { "Marill", 183, 0, 3, 100, 0, 1, 10, 17, 900, 900, 23, 23 },
+    { "Azumarill", 184, 0, 4, 100, 0, 1, 10, 17, 2000, 1900, 5, 5 },
+    { "Sudowoodo", 185, 0, 3, 100, 0, 1, 5, 5, 1000, 1000, 27, 27 },
+    { "Hoppip", 187, 0, 1, 100, 0, 1, 11, 2, 400, 400, 25, 25 },
+    { "Skiploom", 188, 0, 3, 100, 0, 1, 11, 2, 1100, 1100, 0, 0 },
+    { "Sunkern", 191, 0, 1, 100, 0, 1, 11, 11, 500, 500, 6, 6 },
+    { "Sunflora", 192, 0, 3, 100, 0, 1, 11, 11, 6500, 6500, 7, 7 },
+    { "Wooper", 194, 1, 1, 100, 0, 1, 3, 4, 3700, 3700, 26, 26 },
+    { "Murkrow", 198, 0, 2, 100, 0, 1, 16, 2, 1200, 1200, 1, 1 },
+    { "Slowking", 199, 0, 5, 100, 0, 1, 10, 13, 1000, 1000, 28, 28 },
+    { "Misdreavus", 200, 0, 2, 100, 0, 1, 7, 7, -1, 3200, 14, 14 },
+    { "Girafarig", 203, 0, 3, 100, 0, 1, 0, 13, 1300, 1300, 7, 7 },
+    { "Pineco", 204, 0, 2, 100, 0, 1, 6, 6, 1300, 1300, 16, 16 },
+    { "Forretress", 205, 0, 4, 100, 0, 1, 6, 8, 1300, 1300, 18, 18 },
+    { "Dunsparce", 206, 0, 3, 100, 0, 1, 0, 0, 1400, 1400, 21, 21 },
+    { "Dunsparce", 206, 0, 1, 100, 0, 1, 0, 0, 600, 600, 26, 26 },
+    { "Qwilfish", 211, 0, 3, 100, 0, 1, 10, 3, 1500, 1500, 24, 24 },
+    { "Scizor", 212, 0, 5, 100, 0, 1, 6, 8, 1100, 1100, 12, 12 },
+    { "Heracross", 214, 0, 4, 100, 0, 1, 6, 1, 1400, 1400, 11, 11 },
+    { "Sneasel", 215, 0, 3, 100, 0, 1, 16, 14, 1600, 1600, 0, 0 },
+    { "Teddiursa", 216, 0, 2, 100, 0, 1, 0, 0, 1400, 1400, 10, 10 },
+    { "Ursaring", 217, 0, 4, 100, 0, 1, 0, 0, 1500, 1500, 11, 11 },
+    { "Delibird", 225, 0, 5, 100, 0, 1, 14, 2, 1200, 1200, 2, 2 },
+    { "Houndour", 228, 0, 2, 100, 0, 1, 16, 9, 1500, 1500, 8, 8 },
+    { "Houndoom", 229, 0, 5, 100, 0, 1, 16, 9, 1300, 1300, 22, 22 },
+    { "Phanpy", 231, 0, 2, 100, 0, 1, 4, 4, 1600, 1600, 4, 4 },
+    { "Donphan", 232, 0, 4, 100, 0, 1, 4, 4, 1600, 1600, 18, 18 },
+    { "Stantler", 234, 0, 3, 100, 0, 1, 0, 0, 1700, 1700, 23, 23 },
+    { "Blissey", 242, 0, 5, 100, 0, 1, 0, 0, 1400, 1400, 19, 19 },
+    { "Larvitar", 246, 0, 3, 100, 0, 1, 5, 4, 1800, -1, 24, 24 },
+    { "Pupitar", 247, 0, 4, 100, 0, 1, 5, 4, 1700, -1, 11, 11 },
+    { "Tyranitar", 248, 0, 5, 100, 0, 1, 5, 16, 1500, -1, 12, 12 },
+    { "Wingull", 278, 0, 1, 100, 0, 1, 10, 2, 800, 800, 25, 25 },
+    { "Pelipper", 279, 0, 3, 100, 0, 1, 10, 2, 2000, 1900, 23, 23 },
+    { "Ralts", 280, 0, 1, 100, 0, 1, 13, 17, 700, 700, 6, 6 },
+    { "Kirlia", 281, 0, 3, 100, 0, 1, 13, 17, 1900, 1800, 21, 21 },
+    { "Gardevoir", 282, 0, 5, 100, 0, 1, 13, 17, 1600, 1500, 22, 22 },
+    { "Surskit", 283, 0, 1, 100, 0, 1, 6, 10, 900, 900, 25, 25 },
+    { "Masquerain", 284, 0, 4, 100, 0, 1, 6, 2, 1800, 1700, 3, 3 },
+    { "Shroomish", 285, 0, 1, 100, 0, 1, 11, 11, 1000, 1000, 29, 29 },
+    { "Breloom", 286, 0, 5, 100, 0, 1, 11, 1, 8600, 8600, 12, 12 },
+    { "Slakoth", 287, 0, 2, 100, 0, 1, 0, 0, 1700, 1700, 4, 4 },
+    { "Vigoroth", 288, 0, 4, 100, 0, 1, 0, 0, 1900, 1800, 11, 11 },
+    { "Slaking", 289, 0, 5, 100, 0, 1, 0, 0, 1700, 1600, 12, 12 },
+    { "Makuhita", 296, 0, 3, 100, 0, 1, 1, 1, 2100, 2000, 21, 21 },
+    { "Makuhita", 296, 0, 1, 100, 0, 1, 1, 1, 5700, 5700, 26, 26 },
+    { "Hariyama", 297, 0, 5, 100, 0, 1, 1, 1, 1900, 1800, 12, 12 },
+    { "Azurill", 298, 0, 1, 100, 0, 1, 0, 17, 300, 300, 26, 26 },
+    { "Sableye", 302, 0, 5, 100, 0, 1, 16, 7, 1800, 1700, 2, 2 },
+    { "Sableye", 302, 0, 3, 100, 0, 1, 16, 7, 2200, 2100, 0, 0 },
+    { "Meditite", 307, 0, 2, 100, 0, 1, 1, 13, 1800, 1800, 1, 1 },
+    { "Medicham", 308, 0, 4, 100, 0, 1, 1, 13, 2100, 2000, 3, 3 },
+    { "Gulpin", 316, 0, 2, 100, 0, 1, 3, 3, -1, 4600, 4, 4 },
+    { "Swalot", 317, 0, 4, 100, 0, 1, 3, 3, -1, 2100, 15, 15 },
+    { "Numel", 322, 0, 3, 100, 0, 1, 9, 4, 2300, 2200, 24, 24 },
+    { "Camerupt", 323, 0, 5, 100, 0, 1, 9, 4, 2000, 1900, 22, 22 },
+    { "Torkoal", 324, 0, 4, 100, 0, 1, 9, 9, 2200, 2200, 18, 18 },
+    { "Spoink", 325, 0, 2, 100, 0, 1, 13, 13, 1900, 1900, 1, 1 },
+    { "Grumpig", 326, 0, 4, 100, 0, 1, 13, 13, 2300, 2300, 15, 15 },
+    { "Cacnea", 331, 0, 2, 100, 0, 1, 11, 11, 2000, 2000, 10, 10 },
+    { "Cacturne", 332, 0, 4, 100, 0, 1, 11, 16, 8600, 8500, 11, 11 },
+    { "Swablu", 333, 0, 1, 100, 0, 1, 0, 2, 1200, 1200, 20, 20 },
+    { "Altaria", 334, 0, 5, 100, 0, 1, 15, 2, 2200, 2100, 28, 28 },
+    { "Zangoose", 335, 0, 4, 100, 0, 1, 0, 0, 7700, 7600, 11, 11 },
+    { "Zangoose", 335, 0, 3, 100, 0, 1, 0, 0, 2400, 2300, 24, 24 },
+    { "Seviper", 336, 0, 4, 100, 0, 1, 3, 3, 7300, 7200, 11, 11 },
+    { "Seviper", 336, 0, 3, 100, 0, 1, 3, 3, 2500, 2400, 24, 24 },
+    { "Barboach", 339, 0, 1, 100, 0, 1, 10, 4, 1100, 1100, 26, 26 },
+    { "Whiscash", 340, 0, 4, 100, 0, 1, 10, 4, 8700, 8600, 5, 5 },
+    { "Shuppet", 353, 0, 2, 100, 0, 1, 7, 7, 2100, 2100, 10, 10 },
+    { "Banette", 354, 0, 4, 100, 0, 1, 7, 7, 2400, 2400, 11, 11 },
+    { "Tropius", 357, 0, 4, 100, 0, 1, 11, 2, 2500, 2500, 5, 5 },
+    { "Snorunt", 361, 0, 2, 100, 0, 1, 14, 14, 2200, 2200, 4, 4 },
+    { "Glalie", 362, 0, 5, 100, 0, 1, 14, 14, 2300, 2200, 19, 19 },
+    { "Luvdisc", 370, 0, 2, 100, 0, 1, 10, 10, 2300, 2300, 1, 1 },
+    { "Bagon", 371, 0, 3, 100, 0, 1, 15, 15, -1, 2500, 24, 24 },
+    { "Shelgon", 372, 0, 4, 100, 0, 1, 15, 15, -1, 2600, 18, 18 },
+    { "Salamence", 373, 0, 5, 100, 0, 1, 15, 2, -1, 2300, 12, 12 },
+    { "Starly", 396, 0, 1, 100, 0, 1, 0, 2, 1300, 1300, 25, 25 },
+    { "Staravia", 397, 0, 3, 100, 0, 1, 0, 2, 5500, 5500, 21, 21 },
+    { "Staraptor", 398, 0, 5, 100, 0, 1, 0, 2, 2400, 2400, 12, 12 },
+    { "Kricketot", 401, 0, 1, 100, 0, 1, 6, 6, 1400, 1400, 29, 29 },
+    { "Kricketune", 402, 0, 3, 100, 0, 1, 6, 6, 2600, 2600, 24, 24 },
+    { "Shinx", 403, 0, 2, 100, 0, 1, 12, 12, 2400, 2400, 10, 10 },
+    { "Luxio", 404, 0, 3, 100, 0, 1, 12, 12, 2700, 2700, 24, 24 },
+    { "Luxray", 405, 0, 5, 100, 0, 1, 12, 12, 2500, 2500, 12, 12 },
+    { "Combee", 415, 0, 1, 100, 0, 1, 6, 2, 1500, 1500, 25, 25 },
+    { "Vespiquen", 416, 0, 4, 100, 0, 1, 6, 2, 8400, 8300, 18, 18 },
+    { "Pachirisu", 417, 0, 3, 100, 0, 1, 12, 12, 2800, 2800, 23, 23 },
+    { "Buizel", 418, 0, 2, 100, 0, 1, 10, 10, 2500, 2500, 1, 1 },
+    { "Floatzel", 419, 0, 4, 100, 0, 1, 10, 10, 2600, 2700, 3, 3 },
+    { "Shellos", 422, 0, 2, 100, 0, 1, 10, 10, 2600, -1, 14, 14 },
+    { "Shellos", 422, 1, 2, 100, 0, 1, 10, 10, -1, 2600, 14, 14 },
+    { "Gastrodon", 423, 0, 4, 100, 0, 1, 10, 4, -1, 6400, 15, 15 },
+    { "Gastrodon", 423, 1, 4, 100, 0, 1, 10, 4, 6400, -1, 15, 15 },
+    { "Drifloon", 425, 0, 2, 100, 0, 1, 7, 2, 2700, -1, 4, 4 },
+    { "Drifblim", 426, 0, 5, 100, 0, 1, 7, 2, 2600, -1, 19, 19 },
+    { "Drifblim", 426, 0, 4, 100, 0, 1, 7, 2, 6500, -1, 5, 5 },
+    { "Mismagius", 429, 0, 5, 100, 0, 1, 7, 7, -1, 2700, 28, 28 },
+    { "Honchkrow", 430, 0, 5, 100, 0, 1, 16, 2, 2700, 2600, 12, 12 },
+    { "Stunky", 434, 0, 2, 100, 0, 1, 3, 16, 5200, -1, 1, 1 },
+    { "Skuntank", 435, 0, 4, 100, 0, 1, 3, 16, 2700, -1, 11, 11 },
+    { "Bronzor", 436, 0, 3, 100, 0, 1, 8, 13, 2900, 2900, 27, 27 },
+    { "Bronzong", 437, 0, 5, 100, 0, 1, 8, 13, 2800, 2800, 13, 13 },
+    { "Bonsly", 438, 0, 1, 100, 0, 1, 5, 5, 1600, 1600, 17, 17 },
+    { "Gible", 443, 0, 3, 100, 0, 1, 15, 4, 3000, 3000, 24, 24 },
+    { "Gabite", 444, 0, 4, 100, 0, 1, 15, 4, 2800, 2800, 11, 11 },
+    { "Garchomp", 445, 0, 5, 100, 0, 1, 15, 4, 2900, 2900, 12, 12 },
+    { "Riolu", 447, 0, 3, 100, 0, 1, 1, 1, 3100, 3100, 0, 0 },
+    { "Hippopotas", 449, 0, 3, 100, 0, 1, 4, 4, 3200, 3200, 27, 27 },
+    { "Hippowdon", 450, 0, 5, 100, 0, 1, 4, 4, 3000, 3000, 13, 13 },
+    { "Croagunk", 453, 0, 2, 100, 0, 1, 3, 1, 2800, 2700, 10, 10 },
+    { "Toxicroak", 454, 0, 4, 100, 0, 1, 3, 1, 6600, 6500, 11, 11 },
+    { "Finneon", 456, 0, 2, 100, 0, 1, 10, 10, 2900, 2800, 14, 14 },
+    { "Finneon", 456, 0, 1, 100, 0, 1, 10, 10, 1700, 1700, 25, 25 },
+    { "Lumineon", 457, 0, 4, 100, 0, 1, 10, 10, 2900, 2900, 9, 9 },
+    { "Snover", 459, 0, 3, 100, 0, 1, 11, 14, 3300, 3300, 0, 0 },
+    { "Abomasnow", 460, 0, 5, 100, 0, 1, 11, 14, 3100, 3100, 12, 12 },
+    { "Weavile", 461, 0, 5, 100, 0, 1, 16, 14, 3200, 3200, 2, 2 },
+    { "Magnezone", 462, 0, 5, 100, 0, 1, 12, 8, 3300, 3300, 22, 22 },
+    { "Gallade", 475, 0, 5, 100, 0, 1, 13, 1, 3400, 3400, 12, 12 },
+    { "Froslass", 478, 0, 5, 100, 0, 1, 14, 7, 3500, 3500, 2, 2 },
+    { "Rotom", 479, 0, 5, 100, 0, 1, 12, 7, 3600, 3600, 22, 22 },
+    { "Rotom", 479, 0, 4, 100, 0, 1, 12, 7, 3000, 3000, 9, 9 },
+    { "Petilil", 548, 0, 1, 100, 0, 1, 11, 11, 1800, 1800, 6, 6 },
+    { "Lilligant", 549, 0, 4, 100, 0, 1, 11, 11, 3100, 3100, 9, 9 },
+    { "Basculin", 550, 0, 3, 100, 0, 1, 10, 10, 3400, 3400, 24, 24 },
+    { "Sandile", 551, 0, 2, 100, 0, 1, 4, 16, 3000, 2900, 10, 10 },
+    { "Krokorok", 552, 0, 4, 100, 0, 1, 4, 16, 3200, 3200, 11, 11 },
+    { "Krookodile", 553, 0, 5, 100, 0, 1, 4, 16, 3700, 3700, 12, 12 },
+    { "Zorua", 570, 0, 3, 100, 0, 1, 16, 16, 3500, 3500, 7, 7 },
+    { "Zoroark", 571, 0, 5, 100, 0, 1, 16, 16, 3800, 3800, 22, 22 },
+    { "Gothita", 574, 0, 2, 100, 0, 1, 13, 13, 3100, 3000, 14, 14 },
+    { "Gothorita", 575, 0, 3, 100, 0, 1, 13, 13, 6900, 6900, 23, 23 },
+    { "Gothitelle", 576, 0, 5, 100, 0, 1, 13, 13, 3900, 3900, 28, 28 },
+    { "Deerling", 585, 0, 1, 100, 0, 1, 0, 11, 1900, 1900, 29, 29 },
+    { "Sawsbuck", 586, 0, 4, 100, 0, 1, 0, 11, 3300, 3300, 11, 11 },
+    { "Foongus", 590, 0, 2, 100, 0, 1, 11, 3, 3200, 3100, 16, 16 },
+    { "Amoonguss", 591, 0, 5, 100, 0, 1, 11, 3, 4000, 4000, 19, 19 },
+    { "Alomomola", 594, 0, 4, 100, 0, 1, 10, 10, 6700, 6600, 5, 5 },
+    { "Tynamo", 602, 0, 1, 100, 0, 1, 12, 12, 4900, 4900, 25, 25 },
+    { "Eelektrik", 603, 0, 4, 100, 0, 1, 12, 12, 3400, 3400, 5, 5 },
+    { "Eelektross", 604, 0, 5, 100, 0, 1, 12, 12, 4200, 4200, 19, 19 },
+    { "Axew", 610, 0, 3, 100, 0, 1, 15, 15, 1200, 1200, 24, 24 },
+    { "Fraxure", 611, 0, 4, 100, 0, 1, 15, 15, 3500, 3500, 11, 11 },
+    { "Haxorus", 612, 0, 5, 100, 0, 1, 15, 15, 4100, 4100, 12, 12 },
+    { "Cubchoo", 613, 0, 3, 100, 0, 1, 14, 14, 3600, 3600, 24, 24 },
+    { "Beartic", 614, 0, 4, 100, 0, 1, 14, 14, 3600, 3600, 11, 11 },
+    { "Cryogonal", 615, 0, 4, 100, 0, 1, 14, 14, 3700, 3700, 15, 15 },
+    { "Pawniard", 624, 0, 2, 100, 0, 1, 16, 8, 3300, 3300, 10, 10 },
+    { "Bisharp", 625, 0, 4, 100, 0, 1, 16, 8, 3800, 3800, 11, 11 },
+    { "Rufflet", 627, 0, 3, 100, 0, 1, 0, 2, 3700, 3700, 24, 24 },
+    { "Braviary", 628, 0, 5, 100, 0, 1, 0, 2, 4300, 4300, 12, 12 },
+    { "Deino", 633, 0, 3, 100, 0, 1, 16, 15, 3800, -1, 7, 7 },
+    { "Zweilous", 634, 0, 4, 100, 0, 1, 16, 15, 3900, -1, 9, 9 },
+    { "Hydreigon", 635, 0, 5, 100, 0, 1, 16, 15, 4400, -1, 22, 22 },
+    { "Larvesta", 636, 0, 3, 100, 0, 1, 6, 9, 6300, 6300, 24, 24 },
+    { "Volcarona", 637, 0, 5, 100, 0, 1, 6, 9, 4500, 4400, 22, 22 },
+    { "Fletchling", 661, 0, 2, 100, 0, 1, 0, 2, 3400, 3400, 1, 1 },
+    { "Fletchinder", 662, 0, 3, 100, 0, 1, 9, 2, 6400, 6400, 0, 0 },
+    { "Talonflame", 663, 0, 5, 100, 0, 1, 9, 2, 4600, 4500, 2, 2 },
+    { "Litleo", 667, 0, 1, 100, 0, 1, 9, 0, 2000, 2000, 6, 6 },
+    { "Pyroar", 668, 0, 4, 100, 0, 1, 9, 0, 4000, 3900, 9, 9 },
+    { "Flabébé", 669, 0, 1, 100, 0, 1, 17, 17, 2100, 2100, 20, 20 },
+    { "Florges", 671, 0, 5, 100, 0, 1, 17, 17, 4700, 4600, 28, 28 },
+    { "Skiddo", 672, 0, 1, 100, 0, 1, 11, 11, 2200, 2200, 29, 29 },
+    { "Gogoat", 673, 0, 4, 100, 0, 1, 11, 11, 4100, 4000, 9, 9 },
+    { "Skrelp", 690, 0, 2, 100, 0, 1, 3, 10, 3500, -1, 14, 14 },
+    { "Dragalge", 691, 0, 5, 100, 0, 1, 3, 15, 4800, -1, 28, 28 },
+    { "Clauncher", 692, 0, 2, 100, 0, 1, 10, 10, -1, 3500, 8, 8 },
+    { "Clawitzer", 693, 0, 5, 100, 0, 1, 10, 10, -1, 4700, 22, 22 },
+    { "Hawlucha", 701, 0, 4, 100, 0, 1, 1, 2, 4200, 4100, 3, 3 },
+    { "Dedenne", 702, 0, 4, 100, 0, 1, 12, 17, 8300, 8200, 9, 9 },
+    { "Dedenne", 702, 0, 3, 100, 0, 1, 12, 17, 7000, 7000, 0, 0 },
+    { "Goomy", 704, 0, 3, 100, 0, 1, 15, 15, 3900, 3800, 23, 23 },
+    { "Sliggoo", 705, 0, 4, 100, 0, 1, 15, 15, 4300, 4200, 15, 15 },
+    { "Goodra", 706, 0, 5, 100, 0, 1, 15, 15, 4900, 4800, 28, 28 },
+    { "Bergmite", 712, 0, 3, 100, 0, 1, 14, 14, 4000, 3900, 27, 27 },
+    { "Avalugg", 713, 0, 5, 100, 0, 1, 14, 14, 5000, 4900, 13, 13 },
+    { "Noibat", 714, 0, 3, 100, 0, 1, 2, 15, 4100, 4000, 0, 0 },
+    { "Noivern", 715, 0, 5, 100, 0, 1, 2, 15, 5100, 5000, 2, 2 },
+    { "Yungoos", 734, 0, 1, 100, 0, 1, 0, 0, 2300, 2300, 29, 29 },
+    { "Gumshoos", 735, 0, 3, 100, 0, 1, 0, 0, 4200, 4100, 24, 24 },
+    { "Crabrawler", 739, 0, 1, 100, 0, 1, 1, 1, 2400, 2400, 29, 29 },
+    { "Crabominable", 740, 0, 4, 100, 0, 1, 1, 14, 4400, 4300, 11, 11 },
+    { "Oricorio", 741, 0, 4, 100, 0, 1, 9, 2, 4500, 4400, 9, 9 },
+    { "Rockruff", 744, 0, 1, 100, 0, 1, 5, 5, 2500, 2500, 29, 29 },
+    { "Lycanroc", 745, 0, 4, 100, 0, 1, 5, 5, 4700, 4600, 11, 11 },
+    { "Lycanroc", 745, 1, 4, 100, 0, 1, 5, 5, 4600, 4500, 11, 11 },
+    { "Mareanie", 747, 0, 3, 100, 0, 1, 3, 10, 4300, 4200, 27, 27 },
+    { "Mudbray", 749, 0, 2, 100, 0, 1, 4, 4, 3600, 3600, 16, 16 },
+    { "Mudsdale", 750, 0, 5, 100, 0, 1, 4, 4, 8800, 8800, 12, 12 },
+    { "Fomantis", 753, 0, 1, 100, 0, 1, 11, 11, 2600, 2600, 29, 29 },
+    { "Lurantis", 754, 0, 4, 100, 0, 1, 11, 11, 4800, 4700, 11, 11 },
+    { "Salandit", 757, 0, 2, 100, 0, 1, 3, 9, 3700, 3700, 8, 8 },
+    { "Bounsweet", 761, 0, 1, 100, 0, 1, 11, 11, 2700, 2700, 26, 26 },
+    { "Steenee", 762, 0, 3, 100, 0, 1, 11, 11, 6800, 6800, 0, 0 },
+    { "Tsareena", 763, 0, 5, 100, 0, 1, 11, 11, 5200, 5100, 12, 12 },
+    { "Oranguru", 765, 0, 5, 100, 0, 1, 0, 13, 8700, -1, 22, 22 },
+    { "Oranguru", 765, 0, 3, 100, 0, 1, 0, 13, 7100, -1, 7, 7 },
+    { "Passimian", 766, 0, 5, 100, 0, 1, 1, 1, -1, 8700, 12, 12 },
+    { "Passimian", 766, 0, 3, 100, 0, 1, 1, 1, -1, 7100, 24, 24 },
+    { "Sandygast", 769, 0, 2, 100, 0, 1, 7, 4, 4500, 4500, 16, 16 },
+    { "Komala", 775, 0, 4, 100, 0, 1, 0, 0, 4900, 4800, 5, 5 },
+    { "Mimikyu", 778, 0, 5, 100, 0, 1, 7, 17, 5300, 5200, 28, 28 },
+    { "Bruxish", 779, 0, 3, 100, 0, 1, 10, 13, 5600, 5600, 24, 24 },
+    { "Skwovet", 819, 0, 1, 100, 0, 1, 0, 0, 2900, 2900, 26, 26 },
+    { "Greedent", 820, 0, 5, 100, 0, 1, 0, 0, 2100, 2000, 13, 13 },
+    { "Greedent", 820, 0, 3, 100, 0, 1, 0, 0, 5300, 5300, 27, 27 },
+    { "Rookidee", 821, 0, 1, 100, 0, 1, 2, 2, 3000, 3000, 25, 25 },
+    { "Corvisquire", 822, 0, 3, 100, 0, 1, 2, 2, 7200, 7200, 24, 24 },
+    { "Corviknight", 823, 0, 5, 100, 0, 1, 2, 8, 5400, 5300, 13, 13 },
+    { "Chewtle", 833, 0, 1, 100, 0, 1, 10, 10, 2800, 2800, 29, 29 },
+    { "Drednaw", 834, 0, 4, 100, 0, 1, 10, 5, 6800, 6700, 11, 11 },
+    { "Rolycoly", 837, 0, 2, 100, 0, 1, 5, 5, 3900, 3900, 16, 16 },
+    { "Carkol", 838, 0, 3, 100, 0, 1, 5, 9, 5400, 5400, 27, 27 },
+    { "Coalossal", 839, 0, 5, 100, 0, 1, 5, 9, 5800, 5700, 13, 13 },
+    { "Applin", 840, 0, 1, 100, 0, 1, 11, 15, 5000, 5000, 26, 26 },
+    { "Flapple", 841, 0, 5, 100, 0, 1, 11, 15, 6200, 6100, 12, 12 },
+    { "Appletun", 842, 0, 5, 100, 0, 1, 11, 15, 6300, 6200, 22, 22 },
+    { "Silicobra", 843, 0, 1, 100, 0, 1, 4, 4, 5400, 5400, 26, 26 },
+    { "Sandaconda", 844, 0, 4, 100, 0, 1, 4, 4, 7000, 6900, 18, 18 },
+    { "Arrokuda", 846, 0, 2, 100, 0, 1, 10, 10, 4600, 4700, 1, 1 },
+    { "Barraskewda", 847, 0, 4, 100, 0, 1, 10, 10, 5100, 5000, 3, 3 },
+    { "Toxel", 848, 0, 1, 100, 0, 1, 12, 3, 3100, 3100, 6, 6 },
+    { "Toxtricity", 849, 0, 5, 100, 0, 1, 12, 3, 5500, -1, 22, 22 },
+    { "Toxtricity", 849, 1, 5, 100, 0, 1, 12, 3, -1, 5400, 22, 22 },
+    { "Sinistea", 854, 0, 2, 100, 0, 1, 7, 7, 5000, 5100, 8, 8 },
+    { "Polteageist", 855, 0, 5, 100, 0, 1, 7, 7, 6100, 6000, 22, 22 },
+    { "Polteageist", 855, 0, 4, 100, 0, 1, 7, 7, 5200, 5100, 9, 9 },
+    { "Hatenna", 856, 0, 1, 100, 0, 1, 13, 13, 3300, 3300, 6, 6 },
+    { "Hattrem", 857, 0, 3, 100, 0, 1, 13, 13, 5700, 5700, 23, 23 },
+    { "Hatterene", 858, 0, 5, 100, 0, 1, 13, 17, 6400, 6300, 28, 28 },
+    { "Impidimp", 859, 0, 2, 100, 0, 1, 16, 17, 4000, 4000, 10, 10 },
+    { "Morgrem", 860, 0, 3, 100, 0, 1, 16, 17, 5200, 5200, 24, 24 },
+    { "Grimmsnarl", 861, 0, 5, 100, 0, 1, 16, 17, 6000, 5900, 12, 12 },
+    { "Falinks", 870, 0, 5, 100, 0, 1, 1, 1, 5600, 5500, 12, 12 },
+    { "Falinks", 870, 0, 4, 100, 0, 1, 1, 1, 6900, 6800, 11, 11 },
+    { "Pincurchin", 871, 0, 5, 100, 0, 1, 12, 12, 5900, 5800, 22, 22 },
+    { "Pincurchin", 871, 0, 3, 100, 0, 1, 12, 12, 5100, 5100, 27, 27 },
+    { "Snom", 872, 0, 1, 100, 0, 1, 14, 6, 3200, 3200, 20, 20 },
+    { "Frosmoth", 873, 0, 4, 100, 0, 1, 14, 6, 7100, 7000, 15, 15 },
+    { "Stonjourner", 874, 0, 4, 100, 0, 1, 5, 5, 5000, -1, 18, 18 },
+    { "Eiscue", 875, 0, 4, 100, 0, 1, 14, 14, -1, 4900, 11, 11 },
+    { "Indeedee", 876, 0, 5, 100, 0, 1, 13, 0, 8900, 8900, 12, 12 },
+    { "Indeedee", 876, 0, 3, 100, 0, 1, 13, 0, 4900, 4900, 7, 7 },
+    { "Indeedee", 876, 1, 5, 100, 0, 1, 13, 0, 9000, 9000, 12, 12 },
+    { "Indeedee", 876, 1, 3, 100, 0, 1, 13, 0, 5000, 5000, 23, 23 },
+    { "Cufant", 878, 0, 2, 100, 0, 1, 8, 8, 3800, 3800, 16, 16 },
+    { "Copperajah", 879, 0, 5, 100, 0, 1, 8, 8, 5700, 5600, 13, 13 },
+    { "Dreepy", 885, 0, 3, 100, 0, 1, 15, 7, -1, 4300, 0, 0 },
+    { "Drakloak", 886, 0, 4, 100, 0, 1, 15, 7, -1, 5200, 3, 3 },
+    { "Dragapult", 887, 0, 5, 100, 0, 1, 15, 7, -1, 6400, 2, 2 },
+    { "Lechonk", 915, 0, 1, 100, 0, 1, 0, 0, 3400, 3400, 26, 26 },
+    { "Oinkologne", 916, 0, 3, 100, 0, 1, 0, 0, 6600, 6600, 21, 21 },
+    { "Oinkologne", 916, 1, 3, 100, 0, 1, 0, 0, 6700, 6700, 21, 21 },
+    { "Dudunsparce", 982, 0, 4, 100, 0, 1, 0, 0, 7200, 7100, 5, 5 },
+    { "Tarountula", 917, 0, 1, 100, 0, 1, 6, 6, 3500, 3500, 17, 17 },
+    { "Spidops", 918, 0, 3, 100, 0, 1, 6, 6, 4400, 4400, 27, 27 },
+    { "Nymble", 919, 0, 1, 100, 0, 1, 6, 6, 3600, 3600, 29, 29 },
+    { "Lokix", 920, 0, 3, 100, 0, 1, 6, 16, 4500, 4500, 24, 24 },
+    { "Rellor", 953, 0, 1, 100, 0, 1, 6, 6, 3800, 3800, 17, 17 },
+    { "Rabsca", 954, 0, 4, 100, 0, 1, 6, 13, 7400, 7300, 9, 9 },
+    { "Greavard", 971, 0, 1, 100, 0, 1, 7, 7, 4600, 4600, 29, 29 },
+    { "Houndstone", 972, 0, 4, 100, 0, 1, 7, 7, 7500, 7400, 11, 11 },
+    { "Flittle", 955, 0, 1, 100, 0, 1, 13, 13, 4700, 4700, 25, 25 },
+    { "Espathra", 956, 0, 4, 100, 0, 1, 13, 13, 7600, 7500, 9, 9 },
+    { "Farigiraf", 981, 0, 4, 100, 0, 1, 0, 13, 7900, 7800, 9, 9 },
+    { "Wiglett", 960, 0, 1, 100, 0, 1, 10, 10, 4100, 4100, 25, 25 },
+    { "Wugtrio", 961, 0, 4, 100, 0, 1, 10, 10, 5300, 5300, 3, 3 },
+    { "Dondozo", 977, 0, 5, 100, 0, 1, 10, 10, 6500, 6500, 19, 19 },
+    { "Veluza", 976, 0, 4, 100, 0, 1, 10, 13, 5400, 5400, 3, 3 },
+    { "Finizen", 963, 0, 3, 100, 0, 1, 10, 10, 4600, 4600, 21, 21 },
+    { "Palafin", 964, 0, 5, 100, 0, 1, 10, 10, 6600, 6600, 19, 19 },
+    { "Smoliv", 928, 0, 1, 100, 0, 1, 11, 0, 4200, 4200, 6, 6 },
+    { "Dolliv", 929, 0, 3, 100, 0, 1, 11, 0, 5800, 5800, 7, 7 },
+    { "Arboliva", 930, 0, 5, 100, 0, 1, 11, 0, 6700, 6700, 22, 22 },
+    { "Capsakid", 951, 0, 2, 100, 0, 1, 11, 11, 4200, 4200, 10, 10 },
+    { "Scovillain", 952, 0, 4, 100, 0, 1, 11, 9, 5500, 5500, 9, 9 },
+    { "Tadbulb", 938, 0, 1, 100, 0, 1, 12, 12, 5100, 5100, 26, 26 },
+    { "Bellibolt", 939, 0, 4, 100, 0, 1, 12, 12, 5600, 5600, 5, 5 },
+    { "Varoom", 965, 0, 2, 100, 0, 1, 8, 3, 4100, 4100, 10, 10 },
+    { "Revavroom", 966, 0, 5, 100, 0, 1, 8, 3, 6800, 6800, 12, 12 },
+    { "Orthworm", 968, 0, 5, 100, 0, 1, 8, 8, 6900, 6900, 13, 13 },
+    { "Tandemaus", 924, 0, 2, 100, 0, 1, 0, 0, 4300, 4300, 1, 1 },
+    { "Maushold", 925, 0, 4, 100, 0, 1, 0, 0, 5700, 5700, 3, 3 },
+    { "Cetoddle", 974, 0, 3, 100, 0, 1, 14, 14, 4700, 4700, 21, 21 },
+    { "Cetitan", 975, 0, 5, 100, 0, 1, 14, 14, 7000, 7000, 19, 19 },
+    { "Frigibax", 996, 0, 3, 100, 0, 1, 15, 14, 4800, 4800, 24, 24 },
+    { "Baxcalibur", 998, 0, 5, 100, 0, 1, 15, 14, 7100, 7100, 12, 12 },
+    { "Tatsugiri", 978, 0, 5, 100, 0, 1, 15, 10, 7200, 7200, 22, 22 },
+    { "Tatsugiri", 978, 1, 5, 100, 0, 1, 15, 10, 7300, 7300, 22, 22 },
+    { "Tatsugiri", 978, 2, 5, 100, 0, 1, 15, 10, 7400, 7400, 22, 22 },
+    { "Cyclizar", 967, 0, 4, 100, 0, 1, 15, 0, 7800, 7700, 3, 3 },
+    { "Pawmi", 921, 0, 1, 100, 0, 1, 12, 12, 4800, 4800, 25, 25 },
+    { "Pawmo", 922, 0, 3, 100, 0, 1, 12, 1, 5900, 5900, 0, 0 },
+    { "Pawmot", 923, 0, 5, 100, 0, 1, 12, 1, 7500, 7500, 2, 2 },
+    { "Wattrel", 940, 0, 1, 100, 0, 1, 12, 2, 3900, 3900, 6, 6 },
+    { "Kilowattrel", 941, 0, 4, 100, 0, 1, 12, 2, 8000, 7900, 3, 3 },
+    { "Bombirdier", 962, 0, 5, 100, 0, 1, 2, 16, 7600, 7600, 12, 12 },
+    { "Squawkabilly", 931, 0, 4, 100, 0, 1, 0, 2, 5800, 5800, 11, 11 },
+    { "Flamigo", 973, 0, 4, 100, 0, 1, 2, 1, 5900, 5900, 11, 11 },
+    { "Nacli", 932, 0, 1, 100, 0, 1, 5, 5, 4300, 4300, 17, 17 },
+    { "Naclstack", 933, 0, 3, 100, 0, 1, 5, 5, 6000, 6000, 27, 27 },
+    { "Garganacl", 934, 0, 5, 100, 0, 1, 5, 5, 7700, 7700, 13, 13 },
+    { "Glimmet", 969, 0, 3, 100, 0, 1, 5, 3, 7300, 7300, 7, 7 },
+    { "Glimmora", 970, 0, 5, 100, 0, 1, 5, 3, 8500, 8500, 22, 22 },
+    { "Shroodle", 944, 0, 1, 100, 0, 1, 3, 0, 4000, 4000, 25, 25 },
+    { "Grafaiai", 945, 0, 4, 100, 0, 1, 3, 0, 8100, 8000, 3, 3 },
+    { "Fidough", 926, 0, 1, 100, 0, 1, 17, 17, 5600, 5600, 17, 17 },
+    { "Dachsbun", 927, 0, 4, 100, 0, 1, 17, 17, 8200, 8100, 18, 18 },
+    { "Maschiff", 942, 0, 1, 100, 0, 1, 16, 16, 4400, 4400, 29, 29 },
+    { "Mabosstiff", 943, 0, 5, 100, 0, 1, 16, 16, 8400, 8400, 12, 12 },
+    { "Bramblin", 946, 0, 2, 100, 0, 1, 11, 7, 5100, 5200, 10, 10 },
+    { "Brambleghast", 947, 0, 5, 100, 0, 1, 11, 7, 7900, 7900, 12, 12 },
+    { "Tinkatink", 957, 0, 2, 100, 0, 1, 17, 8, 4400, 4400, 14, 14 },
+    { "Tinkatuff", 958, 0, 3, 100, 0, 1, 17, 8, 6200, 6200, 23, 23 },
+    { "Tinkaton", 959, 0, 5, 100, 0, 1, 17, 8, 8000, 8000, 28, 28 },
+    { "Charcadet", 935, 0, 3, 100, 0, 1, 9, 9, 6100, 6100, 21, 21 },
+    { "Charcadet", 935, 0, 1, 100, 0, 1, 9, 9, 5300, 5300, 29, 29 },
+    { "Armarouge", 936, 0, 5, 100, 0, 1, 9, 13, 8100, -1, 22, 22 },
+    { "Ceruledge", 937, 0, 5, 100, 0, 1, 9, 7, -1, 8100, 12, 12 },
+    { "Toedscool", 948, 0, 1, 100, 0, 1, 4, 11, 4500, 4500, 20, 20 },
+    { "Toedscruel", 949, 0, 4, 100, 0, 1, 4, 11, 6100, 6100, 15, 15 },
+    { "Kingambit", 983, 0, 5, 100, 0, 1, 16, 8, 8200, 8200, 12, 12 },
+    { "Clodsire", 980, 0, 4, 100, 0, 1, 3, 4, 1200, 1200, 15, 15 },
+    { "Annihilape", 979, 0, 5, 100, 0, 1, 1, 7, 8300, 8300, 12, 12 },
+    { "Gengar", 94, 0, 6, 100, 0, 1, 7, 3, 4600, 4500, 30, 30 },
+    { "Tauros", 128, 1, 6, 100, 0, 1, 1, 1, 3700, 3600, 31, 31 },
+    { "Tauros", 128, 2, 6, 100, 0, 1, 1, 9, 3600, -1, 31, 31 },
+    { "Tauros", 128, 3, 6, 100, 0, 1, 1, 10, -1, 3500, 31, 31 },
+    { "Gyarados", 130, 0, 6, 100, 0, 1, 10, 2, 900, 900, 31, 31 },
+    { "Ditto", 132, 0, 6, 100, 0, 1, 0, 0, 3800, 3700, 32, 32 },
+    { "Vaporeon", 134, 0, 6, 100, 0, 1, 10, 10, 300, 300, 33, 33 },
+    { "Jolteon", 135, 0, 6, 100, 0, 1, 12, 12, 200, 200, 32, 32 },
+    { "Flareon", 136, 0, 6, 100, 0, 1, 9, 9, 100, 100, 31, 31 },
+    { "Dragonite", 149, 0, 6, 100, 0, 1, 15, 2, 1000, 1000, 31, 31 },
+    { "Espeon", 196, 0, 6, 100, 0, 1, 13, 13, 500, 500, 30, 30 },
+    { "Umbreon", 197, 0, 6, 100, 0, 1, 16, 16, 400, 400, 34, 34 },
+    { "Slowking", 199, 0, 6, 100, 0, 1, 10, 13, 0, 0, 34, 34 },
+    { "Scizor", 212, 0, 6, 100, 0, 1, 6, 8, 6100, 6000, 31, 31 },
+    { "Heracross", 214, 0, 6, 100, 0, 1, 6, 1, 5600, 5500, 31, 31 },
+    { "Blissey", 242, 0, 6, 100, 0, 1, 0, 0, 1100, 1100, 33, 33 },
+    { "Tyranitar", 248, 0, 6, 100, 0, 1, 5, 16, 1200, -1, 31, 31 },
+    { "Pelipper", 279, 0, 6, 100, 0, 1, 10, 2, 1400, 1300, 35, 35 },
+    { "Gardevoir", 282, 0, 6, 100, 0, 1, 13, 17, 4800, 4700, 30, 30 },
+    { "Breloom", 286, 0, 6, 100, 0, 1, 11, 1, 5100, 5000, 31, 31 },
+    { "Torkoal", 324, 0, 6, 100, 0, 1, 9, 9, 1300, 1200, 35, 35 },
+    { "Salamence", 373, 0, 6, 100, 0, 1, 15, 2, -1, 1400, 31, 31 },
+    { "Staraptor", 398, 0, 6, 100, 0, 1, 0, 2, 4700, 4600, 31, 31 },
+    { "Garchomp", 445, 0, 6, 100, 0, 1, 15, 4, 1500, 1500, 31, 31 },
+    { "Hippowdon", 450, 0, 6, 100, 0, 1, 4, 4, 6000, 5900, 35, 35 },
+    { "Magnezone", 462, 0, 6, 100, 0, 1, 12, 8, 1600, 1600, 30, 30 },
+    { "Leafeon", 470, 0, 6, 100, 0, 1, 11, 11, 600, 600, 31, 31 },
+    { "Glaceon", 471, 0, 6, 100, 0, 1, 14, 14, 700, 700, 30, 30 },
+    { "Gallade", 475, 0, 6, 100, 0, 1, 13, 1, 4900, 4800, 31, 31 },
+    { "Amoonguss", 591, 0, 6, 100, 0, 1, 11, 3, 2100, 2000, 33, 33 },
+    { "Haxorus", 612, 0, 6, 100, 0, 1, 15, 15, 2200, 2100, 31, 31 },
+    { "Hydreigon", 635, 0, 6, 100, 0, 1, 16, 15, 1700, -1, 30, 30 },
+    { "Volcarona", 637, 0, 6, 100, 0, 1, 6, 9, 1800, 1700, 30, 30 },
+    { "Talonflame", 663, 0, 6, 100, 0, 1, 9, 2, 1900, 1800, 32, 32 },
+    { "Dragalge", 691, 0, 6, 100, 0, 1, 3, 15, 2300, -1, 30, 30 },
+    { "Clawitzer", 693, 0, 6, 100, 0, 1, 10, 10, -1, 2200, 30, 30 },
+    { "Sylveon", 700, 0, 6, 100, 0, 1, 17, 17, 800, 800, 30, 30 },
+    { "Goodra", 706, 0, 6, 100, 0, 1, 15, 15, 2000, 1900, 34, 34 },
+    { "Avalugg", 713, 0, 6, 100, 0, 1, 14, 14, 2400, 2300, 35, 35 },
+    { "Lycanroc", 745, 2, 6, 100, 0, 1, 5, 5, 4500, 4400, 31, 31 },
+    { "Toxapex", 748, 0, 6, 100, 0, 1, 3, 10, 5300, 5200, 35, 35 },
+    { "Mimikyu", 778, 0, 6, 100, 0, 1, 7, 17, 2500, 2400, 34, 34 },
+    { "Corviknight", 823, 0, 6, 100, 0, 1, 2, 8, 2600, 2500, 35, 35 },
+    { "Pincurchin", 871, 0, 6, 100, 0, 1, 12, 12, 2700, 2600, 31, 31 },
+    { "Frosmoth", 873, 0, 6, 100, 0, 1, 14, 6, 5500, 5400, 34, 34 },
+    { "Dragapult", 887, 0, 6, 100, 0, 1, 15, 7, -1, 6400, 32, 32 },
+    { "Farigiraf", 981, 0, 6, 100, 0, 1, 0, 13, 4400, 4300, 33, 33 },
+    { "Dondozo", 977, 0, 6, 100, 0, 1, 10, 10, 2800, 2700, 33, 33 },
+    { "Revavroom", 966, 0, 6, 100, 0, 1, 8, 3, 6400, 6300, 31, 31 },
+    { "Orthworm", 968, 0, 6, 100, 0, 1, 8, 8, 3000, 2900, 35, 35 },
+    { "Maushold", 925, 1, 6, 100, 0, 1, 0, 0, 3900, 3800, 32, 32 },
+    { "Cetitan", 975, 0, 6, 100, 0, 1, 14, 14, 3100, 3000, 33, 33 },
+    { "Baxcalibur", 998, 0, 6, 100, 0, 1, 15, 14, 5400, 5300, 31, 31 },
+    { "Cyclizar", 967, 0, 6, 100, 0, 1, 15, 0, 4300, 4200, 32, 32 },
+    { "Pawmot", 923, 0, 6, 100, 0, 1, 12, 1, 2900, 2800, 31, 31 },
+    { "Kilowattrel", 941, 0, 6, 100, 0, 1, 12, 2, 4200, 4100, 32, 32 },
+    { "Bombirdier", 962, 0, 6, 100, 0, 1, 2, 16, 6200, 6100, 31, 31 },
+    { "Klawf", 950, 0, 6, 100, 0, 1, 5, 5, 4000, 3900, 35, 35 },
+    { "Garganacl", 934, 0, 6, 100, 0, 1, 5, 5, 5700, 5600, 35, 35 },
+    { "Glimmora", 970, 0, 6, 100, 0, 1, 5, 3, 4100, 4000, 30, 30 },
+    { "Grafaiai", 945, 0, 6, 100, 0, 1, 3, 0, 5800, 5700, 32, 32 },
+    { "Dachsbun", 927, 0, 6, 100, 0, 1, 17, 17, 5900, 5800, 35, 35 },
+    { "Mabosstiff", 943, 0, 6, 100, 0, 1, 16, 16, 6300, 6200, 31, 31 },
+    { "Tinkaton", 959, 0, 6, 100, 0, 1, 17, 8, 3200, 3100, 34, 34 },
+    { "Armarouge", 936, 0, 6, 100, 0, 1, 9, 13, 3300, -1, 30, 30 },
+    { "Ceruledge", 937, 0, 6, 100, 0, 1, 9, 7, -1, 3200, 31, 31 },
+    { "Toedscruel", 949, 0, 6, 100, 0, 1, 4, 11, 5000, 4900, 34, 34 },
+    { "Kingambit", 983, 0, 6, 100, 0, 1, 16, 8, 3400, 3300, 31, 31 },
+    { "Clodsire", 980, 0, 6, 100, 0, 1, 3, 4, 5200, 5100, 34, 34 },
+    { "Annihilape", 979, 0, 6, 100, 0, 1, 1, 7, 3500, 3400, 31, 31 },
+    { "Ekans", 23, 0, 3, 100, 0, 1, 3, 3, 100, 100, 24, 24 },
+    { "Ekans", 23, 0, 1, 100, 0, 1, 3, 3, 0, 0, 29, 29 },
+    { "Sandshrew", 27, 0, 3, 100, 0, 1, 4, 4, 200, 200, 27, 27 },
+    { "Sandshrew", 27, 0, 1, 100, 0, 1, 4, 4, 100, 100, 17, 17 },
+    { "Clefairy", 35, 0, 3, 100, 0, 1, 17, 17, 0, 0, 21, 21 },
+    { "Clefable", 36, 0, 4, 100, 0, 1, 17, 17, 0, 0, 15, 15 },
+    { "Vulpix", 37, 0, 2, 100, 0, 1, 9, 9, 0, 0, 8, 8 },
+    { "Ninetales", 38, 0, 5, 100, 0, 1, 9, 9, 0, 0, 28, 28 },
+    { "Poliwag", 60, 0, 1, 100, 0, 1, 10, 10, 300, 300, 6, 6 },
+    { "Poliwhirl", 61, 0, 3, 100, 0, 1, 10, 10, 300, 300, 0, 0 },
+    { "Poliwrath", 62, 0, 5, 100, 0, 1, 10, 1, 100, 100, 12, 12 },
+    { "Bellsprout", 69, 0, 2, 100, 0, 1, 11, 3, 100, 100, 10, 10 },
+    { "Weepinbell", 70, 0, 3, 100, 0, 1, 11, 3, 400, 400, 24, 24 },
+    { "Victreebel", 71, 0, 5, 100, 0, 1, 11, 3, 300, 300, 12, 12 },
+    { "Geodude", 74, 0, 1, 100, 0, 1, 5, 4, 400, 400, 17, 17 },
+    { "Graveler", 75, 0, 4, 100, 0, 1, 5, 4, 100, 100, 18, 18 },
+    { "Golem", 76, 0, 5, 100, 0, 1, 5, 4, 400, 400, 13, 13 },
+    { "Snorlax", 143, 0, 5, 100, 0, 1, 0, 0, 500, 500, 19, 19 },
+    { "Sentret", 161, 0, 1, 100, 0, 1, 0, 0, 500, 500, 25, 25 },
+    { "Furret", 162, 0, 4, 100, 0, 1, 0, 0, 200, 200, 3, 3 },
+    { "Furret", 162, 0, 3, 100, 0, 1, 0, 0, 600, 600, 0, 0 },
+    { "Hoothoot", 163, 0, 1, 100, 0, 1, 0, 2, 600, 600, 20, 20 },
+    { "Noctowl", 164, 0, 4, 100, 0, 1, 0, 2, 300, 300, 15, 15 },
+    { "Noctowl", 164, 0, 3, 100, 0, 1, 0, 2, 700, 700, 23, 23 },
+    { "Spinarak", 167, 0, 1, 100, 0, 1, 6, 3, 700, 700, 29, 29 },
+    { "Ariados", 168, 0, 4, 100, 0, 1, 6, 3, 400, 400, 11, 11 },
+    { "Ariados", 168, 0, 3, 100, 0, 1, 6, 3, 800, 800, 24, 24 },
+    { "Cleffa", 173, 0, 1, 100, 0, 1, 17, 17, 200, 200, 26, 26 },
+    { "Politoed", 186, 0, 5, 100, 0, 1, 10, 10, 200, 200, 12, 12 },
+    { "Aipom", 190, 0, 3, 100, 0, 1, 0, 0, -1, 2400, 0, 0 },
+    { "Yanma", 193, 0, 2, 100, 0, 1, 6, 2, 300, 300, 1, 1 },
+    { "Wooper", 194, 0, 1, 100, 0, 1, 10, 4, 1400, 1400, 26, 26 },
+    { "Quagsire", 195, 0, 4, 100, 0, 1, 10, 4, 1900, 1900, 5, 5 },
+    { "Gligar", 207, 0, 3, 100, 0, 1, 4, 2, 900, -1, 27, 27 },
+    { "Slugma", 218, 0, 2, 100, 0, 1, 9, 9, 400, 400, 16, 16 },
+    { "Magcargo", 219, 0, 4, 100, 0, 1, 9, 5, 500, 500, 18, 18 },
+    { "Swinub", 220, 0, 2, 100, 0, 1, 14, 4, 500, 500, 10, 10 },
+    { "Piloswine", 221, 0, 4, 100, 0, 1, 14, 4, 600, 600, 5, 5 },
+    { "Poochyena", 261, 0, 1, 100, 0, 1, 16, 16, 800, 800, 29, 29 },
+    { "Mightyena", 262, 0, 4, 100, 0, 1, 16, 16, 700, 700, 11, 11 },
+    { "Lotad", 270, 0, 2, 100, 0, 1, 10, 11, 600, 600, 14, 14 },
+    { "Lombre", 271, 0, 3, 100, 0, 1, 10, 11, 1000, 900, 23, 23 },
+    { "Ludicolo", 272, 0, 5, 100, 0, 1, 10, 11, 800, 800, 28, 28 },
+    { "Seedot", 273, 0, 2, 100, 0, 1, 11, 11, 700, 700, 16, 16 },
+    { "Nuzleaf", 274, 0, 3, 100, 0, 1, 11, 16, 1100, 1000, 24, 24 },
+    { "Shiftry", 275, 0, 5, 100, 0, 1, 11, 16, 900, 900, 12, 12 },
+    { "Nosepass", 299, 0, 3, 100, 0, 1, 5, 5, 1200, 1100, 27, 27 },
+    { "Volbeat", 313, 0, 4, 100, 0, 1, 6, 6, 800, -1, 9, 9 },
+    { "Volbeat", 313, 0, 2, 100, 0, 1, 6, 6, 1400, -1, 8, 8 },
+    { "Illumise", 314, 0, 4, 100, 0, 1, 6, 6, -1, 800, 9, 9 },
+    { "Illumise", 314, 0, 2, 100, 0, 1, 6, 6, -1, 1400, 8, 8 },
+    { "Corphish", 341, 0, 2, 100, 0, 1, 10, 10, 800, 800, 10, 10 },
+    { "Crawdaunt", 342, 0, 4, 100, 0, 1, 10, 16, 900, 900, 11, 11 },
+    { "Feebas", 349, 0, 3, 100, 0, 1, 10, 10, 1300, 1200, 0, 0 },
+    { "Feebas", 349, 0, 2, 100, 0, 1, 10, 10, 900, 900, 1, 1 },
+    { "Milotic", 350, 0, 5, 50, 0, 1, 10, 10, 1100, 1100, 28, 28 },
+    { "Duskull", 355, 0, 2, 100, 0, 1, 7, 7, 1000, 1000, 16, 16 },
+    { "Dusclops", 356, 0, 4, 100, 0, 1, 7, 7, 1000, 1000, 18, 18 },
+    { "Chimecho", 358, 0, 4, 100, 0, 1, 13, 13, 1100, 1100, 9, 9 },
+    { "Ambipom", 424, 0, 5, 100, 0, 1, 0, 0, -1, 2150, 2, 2 },
+    { "Chingling", 433, 0, 3, 100, 0, 1, 13, 13, 1400, 1300, 7, 7 },
+    { "Chingling", 433, 0, 1, 100, 0, 1, 13, 13, 900, 900, 6, 6 },
+    { "Munchlax", 446, 0, 3, 100, 0, 1, 0, 0, 500, 500, 21, 21 },
+    { "Munchlax", 446, 0, 2, 100, 0, 1, 0, 0, 200, 200, 4, 4 },
+    { "Yanmega", 469, 0, 5, 100, 0, 1, 6, 2, 600, 600, 22, 22 },
+    { "Gliscor", 472, 0, 5, 100, 0, 1, 4, 2, 2150, -1, 13, 13 },
+    { "Mamoswine", 473, 0, 5, 100, 0, 1, 14, 4, 700, 700, 12, 12 },
+    { "Probopass", 476, 0, 5, 100, 0, 1, 5, 8, 1000, 1000, 13, 13 },
+    { "Dusknoir", 477, 0, 5, 100, 0, 1, 7, 7, 1150, 1150, 19, 19 },
+    { "Timburr", 532, 0, 2, 100, 0, 1, 1, 1, 1100, 1100, 10, 10 },
+    { "Gurdurr", 533, 0, 3, 100, 0, 1, 1, 1, 1500, 1400, 24, 24 },
+    { "Conkeldurr", 534, 0, 5, 100, 0, 1, 1, 1, 1250, 1250, 12, 12 },
+    { "Sewaddle", 540, 0, 1, 100, 0, 1, 6, 11, 1000, 1000, 26, 26 },
+    { "Swadloon", 541, 0, 3, 100, 0, 1, 6, 11, 1600, 1500, 27, 27 },
+    { "Leavanny", 542, 0, 4, 100, 0, 1, 6, 11, 1200, 1200, 11, 11 },
+    { "Basculin", 550, 2, 3, 100, 0, 1, 10, 10, 2200, 2100, 24, 24 },
+    { "Ducklett", 580, 0, 1, 100, 0, 1, 10, 2, 1100, 1100, 6, 6 },
+    { "Swanna", 581, 0, 4, 100, 0, 1, 10, 2, 1300, 1300, 3, 3 },
+    { "Litwick", 607, 0, 2, 100, 0, 1, 7, 9, 1200, 1200, 8, 8 },
+    { "Lampent", 608, 0, 4, 100, 0, 1, 7, 9, 1400, 1400, 9, 9 },
+    { "Chandelure", 609, 0, 5, 100, 0, 1, 7, 9, 1350, 1350, 22, 22 },
+    { "Mienfoo", 619, 0, 3, 100, 0, 1, 1, 1, 1700, 1600, 24, 24 },
+    { "Mienshao", 620, 0, 5, 100, 0, 1, 1, 1, 1450, 1450, 2, 2 },
+    { "Vullaby", 629, 0, 3, 100, 0, 1, 16, 2, 1800, 1700, 27, 27 },
+    { "Mandibuzz", 630, 0, 5, 100, 0, 1, 16, 2, 1550, 1550, 19, 19 },
+    { "Carbink", 703, 0, 4, 100, 0, 1, 5, 17, 1500, 1500, 18, 18 },
+    { "Phantump", 708, 0, 3, 100, 0, 1, 7, 11, 1900, 1800, 27, 27 },
+    { "Trevenant", 709, 0, 5, 100, 0, 1, 7, 11, 1650, 1650, 12, 12 },
+    { "Grubbin", 736, 0, 1, 100, 0, 1, 6, 6, 1200, 1200, 29, 29 },
+    { "Charjabug", 737, 0, 3, 100, 0, 1, 6, 12, 2000, 1900, 7, 7 },
+    { "Vikavolt", 738, 0, 5, 100, 0, 1, 6, 12, 1750, 1750, 22, 22 },
+    { "Cutiefly", 742, 0, 1, 100, 0, 1, 6, 17, 1300, 1300, 25, 25 },
+    { "Ribombee", 743, 0, 4, 100, 0, 1, 6, 17, 1600, 1600, 15, 15 },
+    { "Jangmo-o", 782, 0, 3, 100, 0, 1, 15, 15, 2100, 2000, 24, 24 },
+    { "Hakamo-o", 783, 0, 4, 100, 0, 1, 15, 1, 1700, 1700, 18, 18 },
+    { "Kommo-o", 784, 0, 5, 100, 0, 1, 15, 1, 1850, 1850, 13, 13 },
+    { "Applin", 840, 0, 3, 100, 0, 1, 11, 15, 2400, 2300, 27, 27 },
+    { "Applin", 840, 0, 2, 100, 0, 1, 11, 15, 1300, 1300, 16, 16 },
+    { "Cramorant", 845, 0, 4, 100, 0, 1, 2, 10, 1800, -1, 5, 5 },
+    { "Morpeko", 877, 0, 4, 100, 0, 1, 12, 16, -1, 1800, 11, 11 },
+    { "Basculegion", 902, 0, 5, 100, 0, 1, 10, 7, 1950, -1, 19, 19 },
+    { "Basculegion", 902, 1, 5, 100, 0, 1, 10, 7, -1, 1950, 19, 19 },
+    { "Dipplin", 1011, 0, 4, 100, 0, 1, 11, 15, 2000, 2000, 18, 18 },
+    { "Poltchageist", 1012, 0, 3, 100, 0, 1, 11, 7, 2300, 2200, 7, 7 },
+    { "Sinistcha", 1013, 0, 5, 100, 0, 1, 11, 7, 2050, 2050, 22, 22 },
+    { "Clefable", 36, 0, 6, 99, 0, 1, 17, 17, 0, 0, 34, 34 },
+    { "Ninetales", 38, 0, 6, 99, 0, 1, 9, 9, 99, 99, 34, 34 },
+    { "Poliwrath", 62, 0, 6, 99, 0, 1, 10, 1, 198, 198, 33, 33 },
+    { "Golem", 76, 0, 6, 99, 0, 1, 5, 4, 396, 396, 35, 35 },
+    { "Snorlax", 143, 0, 6, 99, 0, 1, 0, 0, 495, 495, 33, 33 },
+    { "Politoed", 186, 0, 6, 99, 0, 1, 10, 10, 297, 297, 30, 30 },
+    { "Quagsire", 195, 0, 6, 99, 0, 1, 10, 4, 2079, 2178, 35, 35 },
+    { "Ludicolo", 272, 0, 6, 99, 0, 1, 10, 11, 891, 891, 34, 34 },
+    { "Shiftry", 275, 0, 6, 99, 0, 1, 11, 16, 990, 990, 32, 32 },
+    { "Crawdaunt", 342, 0, 6, 99, 0, 1, 10, 16, 1089, 1089, 31, 31 },
+    { "Milotic", 350, 0, 6, 99, 0, 1, 10, 10, 1188, 1188, 34, 34 },
+    { "Ambipom", 424, 0, 6, 99, 0, 1, 0, 0, -1, 594, 32, 32 },
+    { "Yanmega", 469, 0, 6, 99, 0, 1, 6, 2, 594, 693, 30, 30 },
+    { "Gliscor", 472, 0, 6, 99, 0, 1, 4, 2, 693, -1, 35, 35 },
+    { "Mamoswine", 473, 0, 6, 99, 0, 1, 14, 4, 792, 792, 31, 31 },
+    { "Dusknoir", 477, 0, 6, 99, 0, 1, 7, 7, 1287, 1287, 35, 35 },
+    { "Conkeldurr", 534, 0, 6, 99, 0, 1, 1, 1, 1386, 1386, 31, 31 },
+    { "Leavanny", 542, 0, 6, 99, 0, 1, 6, 11, 1485, 1485, 31, 31 },
+    { "Chandelure", 609, 0, 6, 99, 0, 1, 7, 9, 1584, 1584, 30, 30 },
+    { "Mienshao", 620, 0, 6, 99, 0, 1, 1, 1, 1683, 1683, 32, 32 },
+    { "Mandibuzz", 630, 0, 6, 99, 0, 1, 16, 2, 1782, 1782, 34, 34 },
+    { "Trevenant", 709, 0, 6, 99, 0, 1, 7, 11, 1881, 1881, 31, 31 },
+    { "Kommo-o", 784, 0, 6, 99, 0, 1, 15, 1, 1980, 1980, 35, 35 },
+    { "Morpeko", 877, 0, 6, 99, 0, 1, 12, 16, -1, 2079, 31, 31 },
+    { "Basculegion", 902, 0, 6, 99, 0, 1, 10, 7, 2178, -1, 33, 33 },
+    { "Basculegion", 902, 1, 6, 99, 0, 1, 10, 7, -1, 2277, 33, 33 },
+    { "Sinistcha", 1013, 0, 6, 99, 0, 1, 11, 7, 2277, 2376, 30, 30 },
+    { "Sinistcha", 1013, 1, 6, 99, 0, 1, 11, 7, 2376, 2475, 30, 30 },
+    { "Sandshrew", 27, 1, 3, 100, 0, 1, 14, 8, -1, 1500, 27, 27 },
+    { "Vulpix", 37, 1, 3, 100, 0, 1, 14, 14, 1500, -1, 7, 7 },
+    { "Oddish", 43, 0, 1, 100, 0, 1, 11, 3, 0, 0, 6, 6 },
+    { "Gloom", 44, 0, 3, 100, 0, 1, 11, 3, 0, 0, 7, 7 },
+    { "Vileplume", 45, 0, 4, 100, 0, 1, 11, 3, 1700, 1700, 9, 9 },
+    { "Diglett", 50, 1, 3, 100, 0, 1, 4, 8, 1800, 1800, 0, 0 },
+    { "Tentacool", 72, 0, 2, 100, 0, 1, 10, 3, 0, 0, 14, 14 },
+    { "Tentacruel", 73, 0, 4, 100, 0, 1, 10, 3, 0, 0, 15, 15 },
+    { "Geodude", 74, 1, 3, 100, 0, 1, 5, 12, 1900, 1900, 27, 27 },
+    { "Slowpoke", 79, 1, 3, 100, 0, 1, 13, 13, 1600, 1600, 21, 21 },
+    { "Doduo", 84, 0, 2, 100, 0, 1, 0, 2, 100, 100, 10, 10 },
+    { "Dodrio", 85, 0, 4, 100, 0, 1, 0, 2, 100, 100, 11, 11 },
+    { "Seel", 86, 0, 2, 100, 0, 1, 10, 10, 200, 200, 14, 14 },
+    { "Dewgong", 87, 0, 4, 100, 0, 1, 10, 14, 200, 200, 15, 15 },
+    { "Grimer", 88, 1, 3, 100, 0, 1, 3, 16, 1700, 1700, 27, 27 },
+    { "Exeggcute", 102, 0, 1, 100, 0, 1, 11, 13, 100, 100, 6, 6 },
+    { "Exeggutor", 103, 0, 5, 100, 0, 1, 11, 13, 2000, 2000, 22, 22 },
+    { "Hitmonlee", 106, 0, 5, 100, 0, 1, 1, 1, 100, 100, 12, 12 },
+    { "Hitmonchan", 107, 0, 5, 100, 0, 1, 1, 1, 0, 0, 28, 28 },
+    { "Rhyhorn", 111, 0, 3, 100, 0, 1, 4, 5, 100, 100, 24, 24 },
+    { "Rhydon", 112, 0, 4, 100, 0, 1, 4, 5, 300, 300, 11, 11 },
+    { "Horsea", 116, 0, 1, 100, 0, 1, 10, 10, 300, 300, 26, 26 },
+    { "Seadra", 117, 0, 3, 100, 0, 1, 10, 10, 200, 200, 7, 7 },
+    { "Electabuzz", 125, 0, 4, 100, 0, 1, 12, 12, 400, 400, 9, 9 },
+    { "Magmar", 126, 0, 4, 100, 0, 1, 9, 9, 500, 500, 9, 9 },
+    { "Lapras", 131, 0, 5, 100, 0, 1, 10, 14, 700, 700, 19, 19 },
+    { "Porygon", 137, 0, 3, 100, 0, 1, 0, 0, 300, 300, 7, 7 },
+    { "Chinchou", 170, 0, 3, 100, 0, 1, 10, 12, 400, 400, 23, 23 },
+    { "Chinchou", 170, 0, 1, 100, 0, 1, 10, 12, 400, 400, 20, 20 },
+    { "Lanturn", 171, 0, 4, 100, 0, 1, 10, 12, 600, 600, 5, 5 },
+    { "Bellossom", 182, 0, 4, 100, 0, 1, 11, 11, 1800, 1800, 9, 9 },
+    { "Snubbull", 209, 0, 1, 100, 0, 1, 17, 17, 500, 500, 26, 26 },
+    { "Granbull", 210, 0, 4, 100, 0, 1, 17, 17, 700, 700, 5, 5 },
+    { "Skarmory", 227, 0, 5, 100, 0, 1, 8, 2, 1000, 1000, 13, 13 },
+    { "Kingdra", 230, 0, 5, 100, 0, 1, 10, 15, 400, 400, 19, 19 },
+    { "Porygon2", 233, 0, 5, 100, 0, 1, 0, 0, 800, 800, 12, 12 },
+    { "Tyrogue", 236, 0, 1, 100, 0, 1, 1, 1, 200, 200, 29, 29 },
+    { "Hitmontop", 237, 0, 5, 100, 0, 1, 1, 1, 200, 200, 2, 2 },
+    { "Elekid", 239, 0, 2, 100, 0, 1, 12, 12, 300, 300, 8, 8 },
+    { "Magby", 240, 0, 2, 100, 0, 1, 9, 9, 400, 400, 10, 10 },
+    { "Plusle", 311, 0, 3, 100, 0, 1, 12, 12, 500, 500, 0, 0 },
+    { "Minun", 312, 0, 3, 100, 0, 1, 12, 12, 600, 600, 0, 0 },
+    { "Trapinch", 328, 0, 2, 100, 0, 1, 4, 4, 500, 500, 10, 10 },
+    { "Vibrava", 329, 0, 4, 100, 0, 1, 4, 15, 800, 800, 3, 3 },
+    { "Flygon", 330, 0, 5, 100, 0, 1, 4, 15, 1100, 1100, 2, 2 },
+    { "Beldum", 374, 0, 3, 100, 0, 1, 8, 13, 700, 700, 27, 27 },
+    { "Metang", 375, 0, 4, 100, 0, 1, 8, 13, 900, 900, 18, 18 },
+    { "Metagross", 376, 0, 5, 100, 0, 1, 8, 13, 1200, 1200, 12, 12 },
+    { "Cranidos", 408, 0, 3, 100, 0, 1, 5, 5, 800, -1, 24, 24 },
+    { "Rampardos", 409, 0, 4, 100, 0, 1, 5, 5, 1000, -1, 11, 11 },
+    { "Shieldon", 410, 0, 3, 100, 0, 1, 5, 8, -1, 800, 27, 27 },
+    { "Bastiodon", 411, 0, 4, 100, 0, 1, 5, 8, -1, 1000, 18, 18 },
+    { "Rhyperior", 464, 0, 5, 100, 0, 1, 4, 5, 300, 300, 12, 12 },
+    { "Electivire", 466, 0, 5, 100, 0, 1, 12, 12, 500, 500, 12, 12 },
+    { "Magmortar", 467, 0, 5, 100, 0, 1, 9, 9, 600, 600, 22, 22 },
+    { "Porygon-Z", 474, 0, 5, 100, 0, 1, 0, 0, 900, 900, 22, 22 },
+    { "Blitzle", 522, 0, 1, 100, 0, 1, 12, 12, 600, 600, 25, 25 },
+    { "Zebstrika", 523, 0, 4, 100, 0, 1, 12, 12, 1100, 1100, 3, 3 },
+    { "Drilbur", 529, 0, 3, 100, 0, 1, 4, 4, 900, 900, 24, 24 },
+    { "Excadrill", 530, 0, 5, 100, 0, 1, 4, 8, 1300, 1300, 12, 12 },
+    { "Cottonee", 546, 0, 2, 100, 0, 1, 11, 17, 600, 600, 1, 1 },
+    { "Whimsicott", 547, 0, 4, 100, 0, 1, 11, 17, 1200, 1200, 3, 3 },
+    { "Scraggy", 559, 0, 1, 100, 0, 1, 16, 1, 700, 700, 17, 17 },
+    { "Scrafty", 560, 0, 4, 100, 0, 1, 16, 1, 1300, 1300, 18, 18 },
+    { "Minccino", 572, 0, 2, 100, 0, 1, 0, 0, 700, 700, 1, 1 },
+    { "Solosis", 577, 0, 2, 100, 0, 1, 13, 13, 800, 800, 8, 8 },
+    { "Duosion", 578, 0, 3, 100, 0, 1, 13, 13, 1000, 1000, 7, 7 },
+    { "Reuniclus", 579, 0, 5, 100, 0, 1, 13, 13, 1400, 1400, 22, 22 },
+    { "Joltik", 595, 0, 1, 100, 0, 1, 6, 12, 800, 800, 25, 25 },
+    { "Galvantula", 596, 0, 4, 100, 0, 1, 6, 12, 1400, 1400, 3, 3 },
+    { "Golett", 622, 0, 3, 100, 0, 1, 4, 7, 1100, 1100, 24, 24 },
+    { "Golurk", 623, 0, 5, 100, 0, 1, 4, 7, 1500, 1500, 12, 12 },
+    { "Espurr", 677, 0, 1, 100, 0, 1, 13, 13, 900, 900, 6, 6 },
+    { "Meowstic", 678, 0, 4, 100, 0, 1, 13, 13, 1500, -1, 9, 9 },
+    { "Meowstic", 678, 1, 4, 100, 0, 1, 13, 13, -1, 1500, 9, 9 },
+    { "Inkay", 686, 0, 3, 100, 0, 1, 16, 13, 1200, 1200, 21, 21 },
+    { "Malamar", 687, 0, 5, 100, 0, 1, 16, 13, 1600, 1600, 19, 19 },
+    { "Pikipek", 731, 0, 1, 100, 0, 1, 0, 2, 1000, 1000, 29, 29 },
+    { "Trumbeak", 732, 0, 3, 100, 0, 1, 0, 2, 1300, 1300, 24, 24 },
+    { "Dewpider", 751, 0, 2, 100, 0, 1, 10, 6, 900, 900, 16, 16 },
+    { "Araquanid", 752, 0, 4, 100, 0, 1, 10, 6, 1600, 1600, 15, 15 },
+    { "Comfey", 764, 0, 3, 100, 0, 1, 17, 17, 1400, 1400, 23, 23 },
+    { "Minior", 774, 7, 5, 100, 0, 1, 5, 2, 1700, 1700, 13, 13 },
+    { "Milcery", 868, 0, 2, 100, 0, 1, 17, 17, 1000, 1000, 16, 16 },
+    { "Alcremie", 869, 0, 5, 100, 0, 1, 17, 17, 1800, 1800, 28, 28 },
+    { "Duraludon", 884, 0, 5, 100, 0, 1, 8, 15, 1900, 1900, 22, 22 },
+    { "Sandslash", 28, 1, 6, 100, 0, 1, 14, 8, -1, 2000, 35, 35 },
+    { "Ninetales", 38, 1, 6, 100, 0, 1, 14, 17, 2000, -1, 30, 30 },
+    { "Dugtrio", 51, 1, 6, 100, 0, 1, 4, 8, 2400, 2400, 32, 32 },
+    { "Golem", 76, 1, 6, 100, 0, 1, 5, 12, 2500, 2500, 31, 31 },
+    { "Slowbro", 80, 2, 6, 100, 0, 1, 3, 13, 2100, 2100, 33, 33 },
+    { "Muk", 89, 1, 6, 100, 0, 1, 3, 16, 2300, 2300, 33, 33 },
+    { "Exeggutor", 103, 1, 6, 100, 0, 1, 11, 15, 1900, 1900, 30, 30 },
+    { "Lapras", 131, 0, 6, 100, 0, 1, 10, 14, 400, 400, 33, 33 },
+    { "Slowking", 199, 1, 6, 100, 0, 1, 3, 13, 2200, 2200, 34, 34 },
+    { "Skarmory", 227, 0, 6, 100, 0, 1, 8, 2, 700, 700, 35, 35 },
+    { "Kingdra", 230, 0, 6, 100, 0, 1, 10, 15, 100, 100, 33, 33 },
+    { "Porygon2", 233, 0, 6, 100, 0, 1, 0, 0, 500, 500, 33, 33 },
+    { "Flygon", 330, 0, 6, 100, 0, 1, 4, 15, 800, 800, 32, 32 },
+    { "Metagross", 376, 0, 6, 100, 0, 1, 8, 13, 900, 900, 31, 31 },
+    { "Rhyperior", 464, 0, 6, 100, 0, 1, 4, 5, 0, 0, 31, 31 },
+    { "Electivire", 466, 0, 6, 100, 0, 1, 12, 12, 200, 200, 31, 31 },
+    { "Magmortar", 467, 0, 6, 100, 0, 1, 9, 9, 300, 300, 30, 30 },
+    { "Porygon-Z", 474, 0, 6, 100, 0, 1, 0, 0, 600, 600, 30, 30 },
+    { "Excadrill", 530, 0, 6, 100, 0, 1, 4, 8, 1000, 1000, 31, 31 },
+    { "Whimsicott", 547, 0, 6, 100, 0, 1, 11, 17, 1600, 1600, 32, 32 },
+    { "Reuniclus", 579, 0, 6, 100, 0, 1, 13, 13, 1100, 1100, 30, 30 },
+    { "Golurk", 623, 0, 6, 100, 0, 1, 4, 7, 1200, 1200, 31, 31 },
+    { "Malamar", 687, 0, 6, 100, 0, 1, 16, 13, 1300, 1300, 33, 33 },
+    { "Alcremie", 869, 0, 6, 100, 0, 1, 17, 17, 1400, 1400, 34, 34 },
+    { "Duraludon", 884, 0, 6, 100, 0, 1, 8, 15, 1500, 1500, 35, 35 },
+    { "Kleavor", 900, 0, 6, 100, 0, 1, 6, 5, 1700, 1700, 31, 31 },
+    { "Overqwil", 904, 0, 6, 100, 0, 1, 16, 3, 1800, 1800, 35, 35 },
+};
+
+// TABLES[map][black]: the map's standard and black encounter runs.
+inline constexpr Range TABLES[3][2] = {
+    { { 0, 384 }, { 384, 70 } },
+    { { 454, 105 }, { 559, 28 } },
+    { { 587, 86 }, { 673, 27 } },
+};
+
+// Fixed rewards: item ids only (category-resolved entries are dropped).
+inline constexpr Range FIXED_TABLES[] = {
+    { 0, 3 },
+    { 3, 2 },
+    { 5, 3 },
+    { 8, 3 },
+    { 11, 2 },
+    { 13, 3 },
+    { 16, 3 },
+    { 19, 3 },
+    { 22, 2 },
+    { 24, 3 },
+    { 27, 2 },
+    { 29, 3 },
+    { 32, 3 },
+    { 35, 3 },
+    { 38, 2 },
+    { 40, 3 },
+    { 43, 2 },
+    { 45, 3 },
+    { 48, 3 },
+    { 51, 3 },
+    { 54, 3 },
+    { 57, 3 },
+    { 60, 3 },
+    { 63, 3 },
+    { 66, 3 },
+    { 69, 3 },
+    { 72, 3 },
+    { 75, 3 },
+    { 78, 3 },
+    { 81, 3 },
+    { 84, 3 },
+    { 87, 3 },
+    { 90, 3 },
+    { 93, 3 },
+    { 96, 3 },
+    { 99, 3 },
+};
+inline constexpr uint16_t FIXED_ITEMS[] = {
+    1125, 1126, 570, 1125, 570, 1127, 1128, 570, 1126, 1127, 570, 1125, 565, 1126, 1127, 565,
+    1124, 1125, 568, 1125, 1126, 568, 1125, 568, 1126, 1127, 568, 1125, 566, 1126, 1127, 566,
+    1127, 1128, 566, 1127, 1128, 567, 1125, 569, 1126, 1127, 569, 1125, 567, 1124, 1125, 567,
+    1126, 1127, 567, 1127, 1128, 565, 1124, 1125, 569, 1125, 1126, 565, 1127, 1128, 568, 1125,
+    1126, 569, 1125, 1126, 566, 1124, 1125, 570, 1124, 1125, 565, 1125, 1126, 567, 1127, 1128,
+    569, 1124, 1125, 566, 1127, 1128, 568, 1127, 1128, 566, 1127, 1128, 570, 1127, 1128, 565,
+    1127, 1128, 569, 1127, 1128, 567,
+};
+
+inline constexpr LotteryTable LOTTERY_TABLES[] = {
+    { 10100, 0, 9 },
+    { 9700, 9, 8 },
+    { 10600, 17, 18 },
+    { 10000, 35, 11 },
+    { 9700, 46, 8 },
+    { 10000, 54, 11 },
+    { 10000, 65, 8 },
+    { 10100, 73, 9 },
+    { 9700, 82, 8 },
+    { 10000, 90, 11 },
+    { 9700, 101, 8 },
+    { 10000, 109, 11 },
+    { 10400, 120, 18 },
+    { 10400, 138, 18 },
+    { 9700, 156, 8 },
+    { 10000, 164, 11 },
+    { 9700, 175, 8 },
+    { 10000, 183, 8 },
+    { 10000, 191, 11 },
+    { 10400, 202, 18 },
+    { 10000, 220, 8 },
+    { 10100, 228, 9 },
+    { 10400, 237, 18 },
+    { 10100, 255, 9 },
+    { 10000, 264, 9 },
+    { 10000, 273, 8 },
+    { 10000, 281, 8 },
+    { 10100, 289, 9 },
+    { 10400, 298, 18 },
+    { 10000, 316, 8 },
+    { 9900, 324, 19 },
+    { 9850, 343, 19 },
+    { 9900, 362, 19 },
+    { 9900, 381, 19 },
+    { 9900, 400, 19 },
+    { 9900, 419, 19 },
+};
+inline constexpr LotteryItem LOTTERY_ITEMS[] = {
+    { 1125, 1000 }, { 1126, 1400 }, { 1126, 500 }, { 570, 1000 }, { 161, 700 }, { 157, 800 }, { 86, 2500 }, { 87, 1200 },
+    { 0, 1000 }, { 1125, 2300 }, { 1126, 1200 }, { 570, 1000 }, { 156, 400 }, { 150, 400 }, { 153, 400 }, { 86, 3000 },
+    { 0, 1000 }, { 1127, 2300 }, { 1127, 1100 }, { 50, 400 }, { 570, 1000 }, { 173, 800 }, { 87, 1200 }, { 580, 200 },
+    { 92, 500 }, { 1904, 250 }, { 1249, 250 }, { 1250, 250 }, { 1248, 250 }, { 1247, 250 }, { 51, 300 }, { 795, 400 },
+    { 0, 400 }, { 0, 550 }, { 645, 200 }, { 1126, 1500 }, { 1126, 1500 }, { 1127, 400 }, { 570, 1000 }, { 161, 700 },
+    { 157, 700 }, { 174, 1000 }, { 87, 1500 }, { 92, 500 }, { 0, 300 }, { 0, 900 }, { 1125, 2300 }, { 1126, 1200 },
+    { 565, 1000 }, { 151, 400 }, { 152, 400 }, { 153, 400 }, { 86, 3000 }, { 0, 1000 }, { 1126, 1500 }, { 1126, 1500 },
+    { 1127, 400 }, { 565, 1000 }, { 158, 700 }, { 157, 700 }, { 169, 1000 }, { 87, 1500 }, { 92, 500 }, { 0, 300 },
+    { 0, 900 }, { 1124, 2200 }, { 1125, 850 }, { 568, 850 }, { 152, 800 }, { 153, 800 }, { 150, 800 }, { 88, 3000 },
+    { 0, 700 }, { 1125, 1000 }, { 1126, 1400 }, { 1126, 500 }, { 568, 1000 }, { 162, 700 }, { 157, 800 }, { 91, 1200 },
+    { 90, 2500 }, { 0, 1000 }, { 1125, 2300 }, { 1126, 1200 }, { 568, 1000 }, { 152, 400 }, { 153, 400 }, { 150, 400 },
+    { 88, 3000 }, { 0, 1000 }, { 1126, 1500 }, { 1126, 1500 }, { 1127, 400 }, { 568, 1000 }, { 160, 700 }, { 157, 700 },
+    { 172, 1000 }, { 91, 1500 }, { 92, 500 }, { 0, 300 }, { 0, 900 }, { 1125, 2300 }, { 1126, 1200 }, { 566, 1000 },
+    { 155, 400 }, { 151, 400 }, { 152, 400 }, { 88, 3000 }, { 0, 1000 }, { 1126, 1500 }, { 1126, 1500 }, { 1127, 400 },
+    { 566, 1000 }, { 159, 700 }, { 157, 700 }, { 170, 1000 }, { 91, 1500 }, { 92, 500 }, { 0, 300 }, { 0, 900 },
+    { 1127, 2300 }, { 1127, 1100 }, { 50, 400 }, { 566, 1000 }, { 170, 800 }, { 91, 1200 }, { 583, 200 }, { 92, 500 },
+    { 1908, 250 }, { 1232, 250 }, { 1231, 250 }, { 1233, 250 }, { 1234, 250 }, { 51, 300 }, { 795, 200 }, { 0, 400 },
+    { 0, 550 }, { 645, 200 }, { 1127, 2300 }, { 1127, 1100 }, { 50, 400 }, { 567, 1000 }, { 171, 800 }, { 89, 1200 },
+    { 582, 200 }, { 92, 500 }, { 1905, 250 }, { 1235, 250 }, { 1236, 250 }, { 1237, 250 }, { 1238, 250 }, { 51, 300 },
+    { 795, 200 }, { 0, 400 }, { 0, 550 }, { 645, 200 }, { 1125, 2300 }, { 1126, 1200 }, { 569, 1000 }, { 153, 400 },
+    { 150, 400 }, { 156, 400 }, { 90, 3000 }, { 0, 1000 }, { 1126, 1500 }, { 1126, 1500 }, { 1127, 400 }, { 569, 1000 },
+    { 162, 700 }, { 157, 700 }, { 173, 1000 }, { 89, 1500 }, { 92, 500 }, { 0, 300 }, { 0, 900 }, { 1125, 2300 },
+    { 1126, 1200 }, { 567, 1000 }, { 149, 400 }, { 151, 400 }, { 152, 400 }, { 90, 3000 }, { 0, 1000 }, { 1124, 2200 },
+    { 1125, 850 }, { 567, 850 }, { 149, 800 }, { 151, 800 }, { 152, 800 }, { 90, 3000 }, { 0, 700 }, { 1126, 1500 },
+    { 1126, 1500 }, { 1127, 400 }, { 567, 1000 }, { 163, 700 }, { 157, 700 }, { 171, 1000 }, { 89, 1500 }, { 92, 500 },
+    { 0, 300 }, { 0, 900 }, { 1127, 2300 }, { 1127, 1100 }, { 50, 400 }, { 565, 1000 }, { 169, 800 }, { 87, 1200 },
+    { 580, 200 }, { 92, 500 }, { 1908, 250 }, { 1904, 250 }, { 1905, 250 }, { 1907, 250 }, { 1906, 250 }, { 51, 300 },
+    { 795, 200 }, { 0, 400 }, { 0, 550 }, { 645, 200 }, { 1124, 2200 }, { 1125, 850 }, { 569, 850 }, { 153, 800 },
+    { 150, 800 }, { 156, 800 }, { 90, 3000 }, { 0, 700 }, { 1125, 1000 }, { 1126, 1400 }, { 1126, 500 }, { 565, 1000 },
+    { 158, 700 }, { 157, 800 }, { 87, 1200 }, { 86, 2500 }, { 0, 1000 }, { 1127, 2300 }, { 1127, 1100 }, { 50, 400 },
+    { 568, 1000 }, { 172, 800 }, { 91, 1200 }, { 583, 200 }, { 92, 500 }, { 1907, 250 }, { 1239, 250 }, { 1240, 250 },
+    { 1241, 250 }, { 1242, 250 }, { 51, 300 }, { 795, 200 }, { 0, 400 }, { 0, 550 }, { 645, 200 }, { 1125, 1000 },
+    { 1126, 1400 }, { 1126, 500 }, { 569, 1000 }, { 160, 700 }, { 157, 800 }, { 88, 2500 }, { 89, 1200 }, { 0, 1000 },
+    { 1125, 1000 }, { 1126, 1400 }, { 1126, 500 }, { 566, 1000 }, { 159, 700 }, { 157, 700 }, { 91, 1200 }, { 90, 2500 },
+    { 0, 1000 }, { 1124, 2200 }, { 1125, 850 }, { 570, 850 }, { 156, 800 }, { 150, 800 }, { 153, 800 }, { 86, 3000 },
+    { 0, 700 }, { 1124, 2200 }, { 1125, 850 }, { 565, 850 }, { 151, 800 }, { 152, 800 }, { 153, 800 }, { 86, 3000 },
+    { 0, 700 }, { 1125, 1000 }, { 1126, 1400 }, { 1126, 500 }, { 567, 1000 }, { 163, 700 }, { 157, 800 }, { 88, 2500 },
+    { 89, 1200 }, { 0, 1000 }, { 1127, 2300 }, { 1127, 1100 }, { 50, 400 }, { 569, 1000 }, { 173, 800 }, { 89, 1200 },
+    { 582, 200 }, { 92, 500 }, { 1906, 250 }, { 1243, 250 }, { 1244, 250 }, { 1245, 250 }, { 1246, 250 }, { 51, 300 },
+    { 795, 200 }, { 0, 400 }, { 0, 550 }, { 645, 200 }, { 1124, 2200 }, { 1125, 850 }, { 566, 850 }, { 155, 800 },
+    { 151, 800 }, { 152, 800 }, { 88, 3000 }, { 0, 700 }, { 1127, 1200 }, { 1127, 800 }, { 50, 500 }, { 568, 1000 },
+    { 1128, 500 }, { 91, 1000 }, { 583, 200 }, { 92, 500 }, { 1907, 300 }, { 1239, 300 }, { 1240, 300 }, { 1241, 300 },
+    { 1242, 300 }, { 51, 500 }, { 795, 400 }, { 0, 500 }, { 0, 1000 }, { 645, 200 }, { 1606, 100 }, { 1127, 1200 },
+    { 1127, 800 }, { 50, 500 }, { 566, 1000 }, { 1128, 500 }, { 91, 1000 }, { 583, 200 }, { 92, 500 }, { 1908, 300 },
+    { 1232, 300 }, { 1231, 300 }, { 1233, 300 }, { 1234, 250 }, { 51, 500 }, { 795, 400 }, { 0, 500 }, { 0, 1000 },
+    { 645, 200 }, { 1606, 100 }, { 1127, 1200 }, { 1127, 800 }, { 50, 500 }, { 570, 1000 }, { 1128, 500 }, { 87, 1000 },
+    { 580, 200 }, { 92, 500 }, { 1904, 300 }, { 1249, 300 }, { 1250, 300 }, { 1248, 300 }, { 1247, 300 }, { 51, 500 },
+    { 795, 400 }, { 0, 500 }, { 0, 1000 }, { 645, 200 }, { 1606, 100 }, { 1127, 1200 }, { 1127, 800 }, { 50, 500 },
+    { 565, 1000 }, { 1128, 500 }, { 87, 1000 }, { 580, 200 }, { 92, 500 }, { 1908, 300 }, { 1904, 300 }, { 1905, 300 },
+    { 1907, 300 }, { 1906, 300 }, { 51, 500 }, { 795, 400 }, { 0, 500 }, { 0, 1000 }, { 645, 200 }, { 1606, 100 },
+    { 1127, 1200 }, { 1127, 800 }, { 50, 500 }, { 569, 1000 }, { 1128, 500 }, { 89, 1000 }, { 582, 200 }, { 92, 500 },
+    { 1906, 300 }, { 1243, 300 }, { 1244, 300 }, { 1245, 300 }, { 1246, 300 }, { 51, 500 }, { 795, 400 }, { 0, 500 },
+    { 0, 1000 }, { 645, 200 }, { 1606, 100 }, { 1127, 1200 }, { 1127, 800 }, { 50, 500 }, { 567, 1000 }, { 1128, 500 },
+    { 89, 1000 }, { 582, 200 }, { 92, 500 }, { 1905, 300 }, { 1235, 300 }, { 1236, 300 }, { 1237, 300 }, { 1238, 300 },
+    { 51, 500 }, { 795, 400 }, { 0, 500 }, { 0, 1000 }, { 645, 200 }, { 1606, 100 },
+};
+
+inline constexpr const char* TYPE_NAMES[18] = {
+    "Normal", "Fighting", "Flying", "Poison", "Ground", "Rock", "Bug", "Ghost", "Steel", "Fire", "Water", "Grass", "Electric", "Psychic", "Ice", "Dragon", "Dark", "Fairy",
+};
+
+// Sorted by id.
+inline constexpr ItemName ITEM_NAMES[] = {
+    { 50, "Rare Candy" },
+    { 51, "PP Up" },
+    { 86, "Tiny Mushroom" },
+    { 87, "Big Mushroom" },
+    { 88, "Pearl" },
+    { 89, "Big Pearl" },
+    { 90, "Stardust" },
+    { 91, "Star Piece" },
+    { 92, "Nugget" },
+    { 149, "Cheri Berry" },
+    { 150, "Chesto Berry" },
+    { 151, "Pecha Berry" },
+    { 152, "Rawst Berry" },
+    { 153, "Aspear Berry" },
+    { 155, "Oran Berry" },
+    { 156, "Persim Berry" },
+    { 157, "Lum Berry" },
+    { 158, "Sitrus Berry" },
+    { 159, "Figy Berry" },
+    { 160, "Wiki Berry" },
+    { 161, "Mago Berry" },
+    { 162, "Aguav Berry" },
+    { 163, "Iapapa Berry" },
+    { 169, "Pomeg Berry" },
+    { 170, "Kelpsy Berry" },
+    { 171, "Qualot Berry" },
+    { 172, "Hondew Berry" },
+    { 173, "Grepa Berry" },
+    { 174, "Tamato Berry" },
+    { 565, "Health Feather" },
+    { 566, "Muscle Feather" },
+    { 567, "Resist Feather" },
+    { 568, "Genius Feather" },
+    { 569, "Clever Feather" },
+    { 570, "Swift Feather" },
+    { 580, "Balm Mushroom" },
+    { 582, "Pearl String" },
+    { 583, "Comet Shard" },
+    { 645, "Ability Capsule" },
+    { 795, "Bottle Cap" },
+    { 1124, "Exp. Candy XS" },
+    { 1125, "Exp. Candy S" },
+    { 1126, "Exp. Candy M" },
+    { 1127, "Exp. Candy L" },
+    { 1128, "Exp. Candy XL" },
+    { 1231, "Lonely Mint" },
+    { 1232, "Adamant Mint" },
+    { 1233, "Naughty Mint" },
+    { 1234, "Brave Mint" },
+    { 1235, "Bold Mint" },
+    { 1236, "Impish Mint" },
+    { 1237, "Lax Mint" },
+    { 1238, "Relaxed Mint" },
+    { 1239, "Modest Mint" },
+    { 1240, "Mild Mint" },
+    { 1241, "Rash Mint" },
+    { 1242, "Quiet Mint" },
+    { 1243, "Calm Mint" },
+    { 1244, "Gentle Mint" },
+    { 1245, "Careful Mint" },
+    { 1246, "Sassy Mint" },
+    { 1247, "Timid Mint" },
+    { 1248, "Hasty Mint" },
+    { 1249, "Jolly Mint" },
+    { 1250, "Naive Mint" },
+    { 1606, "Ability Patch" },
+    { 1904, "Sweet Herba Mystica" },
+    { 1905, "Salty Herba Mystica" },
+    { 1906, "Sour Herba Mystica" },
+    { 1907, "Bitter Herba Mystica" },
+    { 1908, "Spicy Herba Mystica" },
+};
+
+inline const char* itemName(uint16_t id) {
+    const ItemName* end = ITEM_NAMES + sizeof(ITEM_NAMES) / sizeof(ITEM_NAMES[0]);
+    const ItemName* it = std::lower_bound(ITEM_NAMES, end, id,
+        [](const ItemName& e, uint16_t v) { return e.id < v; });
+    return (it != end && it->id == id) ? it->name : "?";
+}
+
+} // namespace SvRaidTables
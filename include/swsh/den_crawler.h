@@ -1,18 +1,58 @@
 #pragma once
 #include "swsh/den_types.h"
+#include "fixed_capacity.h"
 #include "game_type.h"
+#include <functional>
 #include <vector>
 #include <string>
 
+// One den's new state, produced by DenCrawler::pollLive().
+struct DenPatch {
+    int denIndex;
+    SwShDenInfo info;
+};
+
+// Per-region summary. listed, pending and shinyWithin cover the dens the den
+// lists show (active, with a resolved encounter).
+struct SwShRegionStats {
+    size_t total       = 0;
+    size_t active      = 0;
+    size_t listed      = 0;
+    size_t pending     = 0;   // listed, shiny search not run yet
+    size_t shinyWithin = 0;   // shiny within the requested number of frames
+};
+
+// All storage is fixed-size (276 dens), so the crawler allocates nothing and
+// fits the overlay as well as the app.
 class DenCrawler {
 public:
-    // Read all 276 dens from live game memory via dmntcht
-    bool readLive(GameVersion version);
+    using DenList = FixedVector<SwShDenInfo, SwShOffsets::DEN_COUNT_TOTAL>;
 
-    // Read all 276 dens from a decrypted save file
+    // Read all 276 dens from live game memory via dmntcht, or from a
+    // decrypted save file. Dens come back decoded but not shiny-searched
+    // (shinyKnown = false), so a summary can be shown at once; follow with
+    // predictAll(), or predictPending() a few dens at a time.
+    bool readLive(GameVersion version);
     bool readSave(const std::string& savePath, GameVersion version);
 
-    const std::vector<SwShDenInfo>& dens() const { return dens_; }
+    // Run the shiny search for up to `budget` pending listed dens of `region`
+    // (active, with an encounter), in den order; inactive dens are left to
+    // predictAll(). Returns how many listed dens are still pending.
+    size_t predictPending(SwShDenRegion region, size_t budget);
+    void predictAll();
+
+    SwShRegionStats regionStats(SwShDenRegion region, uint32_t nearFrames) const;
+
+    // Live watch. Re-read the three den regions and compare each den's seed
+    // and flag bytes with the previous snapshot; only changed dens are
+    // resolved and re-predicted, into `out`. Returns false when nothing
+    // changed. Patched dens are shiny-searched. Does not touch dens(), so it
+    // may run on a worker thread; hand the result to applyPatches() on the UI
+    // thread.
+    bool pollLive(std::vector<DenPatch>& out);
+    void applyPatches(const std::vector<DenPatch>& patches);
+
+    const DenList& dens() const { return dens_; }
 
     // Predict the nearest shiny advance for a given seed.
     // Returns the shiny type and sets outAdvance to the advance count (1-based).
@@ -20,12 +60,37 @@ public:
     static SwShShinyType predictShiny(uint64_t seed, uint32_t maxAdvances, uint32_t& outAdvance);
 
 private:
-    std::vector<SwShDenInfo> dens_;
+    static constexpr uint32_t SHINY_SEARCH = 10000;
+    // Bytes of SwShDenData that decoding depends on: seed, stars, roll, type, flags.
+    static constexpr int DIFF_BEGIN = 0x08;
+    static constexpr int DIFF_END   = 0x14;
+
+    static constexpr size_t RAW_SIZE = SwShOffsets::DEN_COUNT_TOTAL * SwShDenData::SIZE;
+
+    DenList dens_;
     GameVersion version_ = GameVersion::Sword;
 
-    bool readRegion(SwShDenRegion region, uint64_t heapOffset, int count, int hashIndexBase);
+    // Raw den bytes from the last live read, indexed like dens_.
+    uint8_t liveRaw_[RAW_SIZE], pollRaw_[RAW_SIZE];
+    bool haveLiveRaw_ = false;
+
+    // predictShiny() results by seed, so a den whose seed flips back (or a
+    // re-read after a day skip) does not search 10,000 advances again.
+    // Cleared when full: about three days of seeds for every den.
+    struct ShinyHit {
+        SwShShinyType type;
+        uint32_t advance;
+    };
+    using ShinyMemo = FixedMap<uint64_t, ShinyHit, 1024, std::hash<uint64_t>>;
+    static constexpr size_t SHINY_MEMO_MAX = ShinyMemo::MAX_SIZE;
+    ShinyMemo shinyMemo_;
+
     bool readRegionFromBuffer(SwShDenRegion region, const uint8_t* data, size_t dataSize,
                               int count, int hashIndexBase);
+    bool readLiveRaw(uint8_t* raw) const;
+    SwShDenInfo decodeDen(SwShDenRegion region, const uint8_t* raw, int denIndex) const;
+    void predict(SwShDenInfo& info);
+    SwShShinyType cachedShiny(uint64_t seed, uint32_t& outAdvance);
 
     // Resolve species + flawlessIVs for a den using encounter tables
     void resolveEncounter(const SwShDenData& den, int globalIndex,
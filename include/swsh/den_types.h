@@ -74,4 +74,5 @@ struct SwShDenInfo {
     int           ivs[6];         // HP, Atk, Def, SpA, SpD, Spe
     SwShShinyType shinyType;
     uint32_t      shinyAdvance;   // 0 = no shiny found within search range
+    bool          shinyKnown;     // false until the den's shiny search has run
 };
@@ -0,0 +1,78 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#ifdef __SWITCH__
+#include <switch.h>
+#endif
+
+namespace ThreadUtil {
+
+// libnx starts std::threads on the process' default core, which is the one the
+// UI thread is already busy on. Call this at the top of a worker's entry point
+// to move it to another core the process is allowed to use; `index` picks the
+// n-th spare core (wrapping) so several workers spread out. No-op elsewhere.
+inline void moveToSpareCore(int index = 0) {
+#ifdef __SWITCH__
+    u64 mask = 0;
+    if (R_FAILED(svcGetInfo(&mask, InfoType_CoreMask, CUR_PROCESS_HANDLE, 0)))
+        return;
+    u32 current = svcGetCurrentProcessorNumber();
+    s32 spare[4];
+    int count = 0;
+    for (u32 core = 0; core < 4; core++) {
+        if (core != current && (mask & (1ULL << core)))
+            spare[count++] = (s32)core;
+    }
+    if (count == 0) return;
+    s32 core = spare[index % count];
+    svcSetThreadCoreMask(CUR_THREAD_HANDLE, core, 1u << core);
+#else
+    (void)index;
+#endif
+}
+
+// Run fn(i) for i in [0, count) on up to `threads` threads, the caller
+// included. Indices are handed out through a shared counter, so uneven work
+// balances itself; extra threads are moved to spare cores 1... Once `cancel`
+// is set no new index is started - a long fn polls it itself (cancelPoll).
+// The extra threads are started by this call and joined before it returns;
+// nothing is kept alive between calls, so keep it to coarse-grained batches.
+template <class Fn>
+void parallelFor(size_t count, int threads, Fn fn,
+                 const std::atomic<bool>* cancel = nullptr) {
+    threads = std::max(1, (int)std::min<size_t>((size_t)std::max(threads, 1), count));
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        for (;;) {
+            size_t i = next.fetch_add(1, std::memory_order_relaxed);
+            if (i >= count) return;
+            if (cancel && cancel->load(std::memory_order_relaxed)) return;
+            fn(i);
+        }
+    };
+    std::vector<std::thread> helpers;
+    for (int t = 1; t < threads; t++) {
+        helpers.emplace_back([&, t] {
+            moveToSpareCore(t);
+            worker();
+        });
+    }
+    worker();
+    for (auto& th : helpers) th.join();
+}
+
+// Cancel check for long serial walks: reads the flag only every 4096 steps,
+// which keeps the atomic load out of the hot loop.
+constexpr uint32_t CANCEL_CHECK_MASK = 0xFFF;
+
+inline bool cancelPoll(const std::atomic<bool>* cancel, uint32_t step) {
+    return (step & CANCEL_CHECK_MASK) == 0 && cancel &&
+           cancel->load(std::memory_order_relaxed);
+}
+
+} // namespace ThreadUtil
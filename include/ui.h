@@ -6,9 +6,20 @@
 #include "swsh/den_crawler.h"
 #include "swsh/den_locations.h"
 #include "pla/pla_reader.h"
+#include "pla/pla_shiny_search.h"
+#include "pla/pla_filter_search.h"
+#include "pla/pla_outbreak_path.h"
+#include "pla/pla_route.h"
+#include "resource_loader.h"
+#include "sprite_atlas.h"
+#include "sprite_cache.h"
+#include "glyph_atlas.h"
+#include "live_watch.h"
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL_image.h>
+#include <atomic>
+#include <future>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -21,6 +32,12 @@ public:
     bool init();
     void shutdown();
     void showSplash();
+
+    // Start parsing data files and decoding map images on a worker thread so
+    // the work overlaps the splash screen. preload() also warms everything the
+    // given game needs; preloadCommon() only what every game uses.
+    void preload(GameVersion game);
+    void preloadCommon();
     void showMessageAndWait(const std::string& title, const std::string& body);
     void showWorking(const std::string& msg);
     void run(const std::string& basePath);
@@ -79,6 +96,19 @@ private:
     bool dirty_ = true;  // redraw needed
     void markDirty() { dirty_ = true; }
 
+    // Background resource loading (see preload()). Futures are reset once waited.
+    ResourceLoader loader_;
+    std::shared_future<void> textReady_;
+    std::shared_future<void> personalReady_;
+    std::shared_future<void> readerReady_;
+    bool readerLoaded_ = false;
+    static std::string dataDir();
+    static std::string mapDir();
+    void prefetchMaps(GameVersion game);
+    SDL_Texture* loadMapTexture(const char* name);
+    bool loadRaidResources();
+    void loadPersonal();
+
     // Account
     AccountManager account_;
     int profileSelCursor_ = 0;
@@ -95,6 +125,47 @@ private:
     RaidReader reader_;
     GameVersion selectedVersion_ = GameVersion::Scarlet;
 
+    // Live watch: re-poll game memory in the background and patch the lists
+    // in place, so new raids/dens/spawners show up without restarting.
+    static constexpr uint32_t WATCH_INTERVAL_MS = 1000;
+    LiveWatch<RaidPatch> raidWatch_;
+    std::vector<RaidPatch> raidPatches_;
+    void applyRaidPatches();
+    LiveWatch<DenPatch> denWatch_;
+    std::vector<DenPatch> denPatches_;
+    void applyDenPatches();
+    LiveWatch<PlaScan> plaWatch_;
+    std::vector<PlaScan> plaScans_;
+    void applyPlaScan();
+
+    // Deep shiny search: the next few shiny advances per group seed, far past
+    // decorate()'s window. Runs in the background after each scan for seeds
+    // not searched yet; the detail popup shows whatever has finished.
+    static constexpr uint32_t DEEP_SHINY_ADVANCES = 1000000;
+    static constexpr int DEEP_SHINY_HITS = 3;
+    static constexpr int DEEP_SHINY_THREADS = 2;
+    static constexpr size_t DEEP_SHINY_MAX = 4096;  // cleared when full
+    using PlaDeepHits = std::unordered_map<uint64_t, PlaShinySearch::Hits>;
+    PlaDeepHits plaDeepHits_;
+    // Hunt targets (PLA_HUNT_LABELS in ui_pla.cpp): the first advance matching
+    // each filter, for the current tab's spawners. The deep search job runs
+    // them after the shiny hits; -1 = none within DEEP_SHINY_ADVANCES.
+    static constexpr int PLA_HUNT_TARGETS = 3;
+    struct PlaHuntHits { int advance[PLA_HUNT_TARGETS]; };
+    using PlaHuntMap = std::unordered_map<uint64_t, PlaHuntHits>;
+    PlaHuntMap plaHuntHits_;
+    int plaHuntTab_ = -1;     // region plaHuntHits_ was searched for
+    struct PlaDeepBatch {
+        PlaDeepHits shiny;
+        PlaHuntMap  hunt;
+        int         tab;
+    };
+    std::future<PlaDeepBatch> plaDeepJob_;
+    std::atomic<bool> plaDeepCancel_{false};
+    void startPlaDeepSearch();
+    void cancelPlaDeepSearch();
+    bool takePlaDeepSearch();
+
     // Text data
     bool textDataLoaded_ = false;
     std::vector<std::string> speciesNames_;
@@ -104,12 +175,19 @@ private:
     std::vector<std::string> typeNames_;
     std::vector<std::string> itemNames_;
     void loadTextData(const std::string& dataDir);
-
-    // Sprite cache: species ID -> texture
-    // Sprite cache keyed by (species | form << 16) so form variants don't collide
-    // with base forms. Loader tries "{NNN}-{form}.png" first, falls back to "{NNN}.png".
-    std::unordered_map<uint32_t, SDL_Texture*> spriteCache_;
-    SDL_Texture* getSprite(uint16_t species, uint8_t form = 0);
+    void readTextData(const std::string& dataDir);
+
+    // Sprites come from the packed atlas; anything it lacks is looked up as a
+    // loose PNG in spriteDir() on the SD card by sprites_.
+    SpriteAtlas spriteAtlas_;
+    bool spriteAtlasAttached_ = false;
+    SpriteCache sprites_{spriteDir()};
+    static std::string atlasDir();
+    static std::string spriteDir();
+    void prefetchSpriteAtlas();
+    void attachSpriteAtlas();
+    // Draw a sprite fitted into a size x size box, preserving aspect ratio.
+    void drawSprite(uint16_t species, uint8_t form, int x, int y, int size);
     void freeSprites();
 
     // Map textures
@@ -172,31 +250,8 @@ private:
     // Map tabs
     void drawMapTabs(int x, int y, int w);
 
-    // Text texture cache
-    struct TextCacheKey {
-        std::string text;
-        TTF_Font* font;
-        uint32_t colorPacked;  // RGBA packed
-
-        bool operator==(const TextCacheKey& o) const {
-            return colorPacked == o.colorPacked && font == o.font && text == o.text;
-        }
-    };
-    struct TextCacheKeyHash {
-        size_t operator()(const TextCacheKey& k) const {
-            size_t h = std::hash<std::string>{}(k.text);
-            h ^= std::hash<uintptr_t>{}((uintptr_t)k.font) + 0x9e3779b9 + (h << 6) + (h >> 2);
-            h ^= std::hash<uint32_t>{}(k.colorPacked) + 0x9e3779b9 + (h << 6) + (h >> 2);
-            return h;
-        }
-    };
-    struct TextCacheEntry {
-        SDL_Texture* tex;
-        int w, h;
-    };
-    std::unordered_map<TextCacheKey, TextCacheEntry, TextCacheKeyHash> textCache_;
-    void freeTextCache();
-    TextCacheEntry& getCachedText(const std::string& text, SDL_Color color, TTF_Font* f);
+    // Text is drawn from per-font glyph atlases
+    GlyphAtlas glyphs_;
 
     // Rendering helpers
     void drawText(const std::string& text, int x, int y, SDL_Color color, TTF_Font* f);
@@ -219,6 +274,7 @@ private:
 
     // Personal data (for type lookups)
     PersonalTable personal_;
+    bool personalLoaded_ = false;
 
     // --- SwSh Den Crawler ---
     DenCrawler denCrawler_;
@@ -246,15 +302,26 @@ private:
     // --- PLA spawner viewer ---
     PlaReader plaReader_;
     PlaOutbreak plaOutbreak_{};
+    PlaOutbreakPath::Result plaOutbreakPath_{};  // for plaOutbreak_ at the current rolls
     int plaCursor_ = 0;
     int plaScroll_ = 0;
     int plaTab_ = 0;          // 0..4 = PlaRegion enum
     bool plaShowDetail_ = false;
     bool plaShinyOnly_ = false;
+    int plaRollPreset_ = 0;   // index into PLA_ROLL_PRESETS (ui_pla.cpp)
+    // Route mode: list (and map path) in visiting order over the spawners
+    // within PLA_ROUTE_MAX_ADVANCE; re-planned incrementally on every rebuild.
+    bool plaRouteMode_ = false;
+    int plaRouteTab_ = -1;    // region the current route was planned for
+    PlaRoutePlanner plaRoute_;
     std::vector<int> plaFiltered_;
     SDL_Texture* plaMaps_[5] = {nullptr, nullptr, nullptr, nullptr, nullptr};
 
+    int plaShinyRolls() const;
+    void decoratePla();
+    void updatePlaOutbreakPath();
     void rebuildPlaFilteredList();
+    void orderPlaByRoute();
     void drawPlaViewFrame();
     void drawPlaMapPanel();
     void drawPlaMapTabs(int x, int y, int w);
@@ -1,6 +1,19 @@
-// pkTeraRaid — libultrahand overlay: quick-glance PLA shiny summary.
-// Root menu lists the 5 Hisui regions; tapping one opens a detail view
-// with current shinies + near-advance spawners. Y rescans memory.
+// pkTeraRaid — libultrahand overlay: quick-glance PLA shiny, SV raid and SwSh
+// den summary. The running title picks the mode. PLA: the root menu lists the
+// 5 Hisui regions; tapping one opens a detail view with current shinies +
+// near-advance spawners. SV: the root menu lists the 3 raid maps with raid,
+// shiny and rare-reward counts; tapping one opens its top raids. SwSh: the
+// root menu lists the 3 den regions with dens that have a shiny within
+// SWSH_NEAR_FRAMES; tapping one lists its active dens. Den shiny searches run
+// a few per frame after the summary is up. Y rescans.
+//
+// Built with PLA_FIXED_CAPACITY (see Makefile): the PLA reader's storage is
+// fixed-size, SvRaidCore decodes raids from compiled-in tables into
+// fixed-size storage and DenCrawler keeps its 276 dens in a fixed array; all
+// three live in the static OverlayState, so scanning and decorating never
+// allocate. Only the tesla UI elements use the heap; the
+// root menu reports heap use and scan time so the budget can be checked on
+// hardware.
 
 #define TESLA_INIT_IMPL
 #include <tesla.hpp>
@@ -8,12 +21,18 @@
 #include "pla/pla_reader.h"
 #include "pla/pla_markers.h"
 #include "pla/pla_region.h"
+#include "sv/sv_raid_core.h"
+#include "swsh/den_crawler.h"
+#include "swsh/den_locations.h"
+#include "species_names.h"
 #include "dmnt_mem.h"
 #include "game_type.h"
 
+#include <malloc.h>
+
 #include <algorithm>
+#include <chrono>
 #include <cstdio>
-#include <vector>
 
 namespace {
 
@@ -22,56 +41,148 @@ constexpr int SHINY_SEARCH    = 5000;
 constexpr int NEAR_THRESHOLD  = 100;
 constexpr size_t TOP_N        = 10;
 
+constexpr TeraRaidMapParent SV_MAPS[] = {
+    TeraRaidMapParent::Paldea, TeraRaidMapParent::Kitakami, TeraRaidMapParent::Blueberry,
+};
+
+constexpr SwShDenRegion SWSH_REGIONS[] = {
+    SwShDenRegion::Vanilla, SwShDenRegion::IslandOfArmor, SwShDenRegion::CrownTundra,
+};
+constexpr uint32_t SWSH_NEAR_FRAMES    = 100;  // "shiny within N frames" count
+// Den shiny searches (up to 10,000 advances each) run per UI frame.
+constexpr size_t   SWSH_PREDICT_BUDGET = 4;
+constexpr size_t   SWSH_MAX_REGION     = SwShOffsets::DEN_COUNT_VANILLA;
+
+// Heap bytes in use (now and the highest sample so far) and the arena newlib
+// has taken from the system, which only grows. Sampled after every scan and
+// screen build, the points where the overlay's heap use peaks.
+struct HeapReport {
+    size_t inUse  = 0;
+    size_t peak   = 0;
+    size_t arena  = 0;
+};
+
 struct OverlayState {
-    PlaReader reader;
-    bool      scanned = false;
-    std::string status;
+    PlaReader   reader;
+    SvRaidCore  sv;
+    DenCrawler  dens;
+    GameVersion game = GameVersion::LegendsArceus;
+    bool        scanned = false;
+    char        status[96] = "";
+    uint32_t    scanMicros = 0;   // last scan: memory reads + decoding
+    HeapReport  heap;
 };
 inline OverlayState& state() {
     static OverlayState s;
     return s;
 }
 
+void sampleHeap() {
+    struct mallinfo mi = mallinfo();
+    HeapReport& h = state().heap;
+    h.inUse = (size_t)mi.uordblks;
+    h.arena = (size_t)mi.arena;
+    h.peak  = std::max(h.peak, h.inUse);
+}
+
+const char* svMapName(TeraRaidMapParent map) {
+    switch (map) {
+        case TeraRaidMapParent::Kitakami:  return "Kitakami";
+        case TeraRaidMapParent::Blueberry: return "Blueberry";
+        default:                           return "Paldea";
+    }
+}
+
+const char* swshRegionName(SwShDenRegion region) {
+    switch (region) {
+        case SwShDenRegion::IslandOfArmor: return "Isle of Armor";
+        case SwShDenRegion::CrownTundra:   return "Crown Tundra";
+        default:                           return "Wild Area";
+    }
+}
+
+// Which game is running; LegendsArceus when it is none of the supported ones
+// (the PLA screens then report the wrong title).
+GameVersion detectGame() {
+    if (!DmntMem::init()) return GameVersion::LegendsArceus;
+    switch (DmntMem::titleId()) {
+        case SCARLET_TITLE_ID: return GameVersion::Scarlet;
+        case VIOLET_TITLE_ID:  return GameVersion::Violet;
+        case SWORD_TITLE_ID:   return GameVersion::Sword;
+        case SHIELD_TITLE_ID:  return GameVersion::Shield;
+        default:               return GameVersion::LegendsArceus;
+    }
+}
+
+const char* gameShortName(GameVersion g) {
+    if (isSV(g)) return "SV";
+    if (isSwSh(g)) return "SwSh";
+    return "PLA";
+}
+
 void performScan() {
     auto& s = state();
-    s.status.clear();
+    s.status[0] = '\0';
     if (!DmntMem::init()) {
-        s.status = "dmnt:cht: could not attach";
+        std::snprintf(s.status, sizeof(s.status), "dmnt:cht: could not attach");
         return;
     }
     uint64_t tid = DmntMem::titleId();
-    if (tid != PLA_TITLE_ID) {
-        char buf[96];
-        std::snprintf(buf, sizeof(buf),
-                      "Wrong title: %016lX (need PLA)", (unsigned long)tid);
-        s.status = buf;
+    if (tid != titleIdOf(s.game)) {
+        std::snprintf(s.status, sizeof(s.status), "Wrong title: %016lX (need %s)",
+                      (unsigned long)tid, gameShortName(s.game));
         return;
     }
-    if (!s.reader.readLive(SCAN_MAX_GROUPS)) {
-        s.status = "readLive() failed";
-        return;
+    auto start = std::chrono::steady_clock::now();
+    if (isSV(s.game)) {
+        if (!s.sv.readLive(s.game)) {
+            std::snprintf(s.status, sizeof(s.status), "No raids found");
+            return;
+        }
+    } else if (isSwSh(s.game)) {
+        // Dens only: the shiny searches run progressively from the menus.
+        if (!s.dens.readLive(s.game)) {
+            std::snprintf(s.status, sizeof(s.status), "readLive() failed");
+            return;
+        }
+    } else {
+        if (!s.reader.readLive(SCAN_MAX_GROUPS)) {
+            std::snprintf(s.status, sizeof(s.status), "readLive() failed");
+            return;
+        }
+        // Decorate every region once per scan; the menus below only read the
+        // cached per-region lists and stats.
+        s.reader.decorateAll(1, SHINY_SEARCH, NEAR_THRESHOLD);
     }
+    s.scanMicros = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
     s.scanned = true;
+    sampleHeap();
 }
 
-struct RegionStats { size_t current; size_t near; size_t total; };
-
-// Compute stats for `region` after decorating. Note: decorate() overwrites the
-// cached per-spawner fields, so we re-decorate each time we need fresh numbers
-// (cheap — no memory I/O, just RNG).
-RegionStats statsFor(PlaRegion region) {
-    auto& s = state();
-    s.reader.decorate(region, 1, SHINY_SEARCH);
-    RegionStats out{0, 0, 0};
-    const auto& sps = s.reader.spawners();
-    for (const auto& sp : sps) {
-        if (sp.region != (int)region) continue;
-        if (sp.speciesId == 0) continue;  // skip story/placeholder spawners
-        out.total++;
-        if (sp.shinyAdvance == 0 && sp.firstSpawn.shiny) out.current++;
-        else if (sp.shinyAdvance > 0 && sp.shinyAdvance <= NEAR_THRESHOLD) out.near++;
-    }
-    return out;
+// Heap, static storage and scan time, at the bottom of both root menus.
+void addBudgetItems(tsl::elm::List* list) {
+    const auto& s = state();
+    const HeapReport& h = s.heap;
+    char heap[64];
+    std::snprintf(heap, sizeof(heap), "%zu KB (peak %zu, arena %zu)",
+                  h.inUse / 1024, h.peak / 1024, h.arena / 1024);
+    auto* heapItem = new tsl::elm::ListItem("Heap");
+    heapItem->setValue(heap);
+    list->addItem(heapItem);
+    char scanner[32];
+    size_t bytes = isSV(s.game) ? sizeof(SvRaidCore)
+                 : isSwSh(s.game) ? sizeof(DenCrawler) : sizeof(PlaReader);
+    std::snprintf(scanner, sizeof(scanner), "%zu KB static", bytes / 1024);
+    auto* scannerItem = new tsl::elm::ListItem("Scanner");
+    scannerItem->setValue(scanner);
+    list->addItem(scannerItem);
+    char scan[32];
+    std::snprintf(scan, sizeof(scan), "%u.%u ms",
+                  (unsigned)(s.scanMicros / 1000), (unsigned)(s.scanMicros % 1000 / 100));
+    auto* scanItem = new tsl::elm::ListItem("Scan time");
+    scanItem->setValue(scan);
+    list->addItem(scanItem);
 }
 
 // Forward decls
@@ -84,39 +195,38 @@ public:
 
     tsl::elm::Element* createUI() override {
         auto& s = state();
-        s.reader.decorate(region_, 1, SHINY_SEARCH);
 
         auto* frame = new tsl::elm::OverlayFrame(plaRegionName(region_), "pkTeraRaid");
         auto* list  = new tsl::elm::List();
 
-        if (!s.status.empty()) {
+        if (s.status[0]) {
             list->addItem(new tsl::elm::ListItem(s.status));
             frame->setContent(list);
             return frame;
         }
 
-        const auto& sps = s.reader.spawners();
-        std::vector<int> current, nearN, farN;
+        const auto& sps = s.reader.regionSpawners(region_);
+        PlaGroupList<int> current, nearN;
+        size_t farCount = 0;
         for (int i = 0; i < (int)sps.size(); i++) {
-            const auto& sp = sps[i];
-            if (sp.region != (int)region_) continue;
-            if (sp.speciesId == 0) continue;  // skip story/placeholder spawners
-            if (sp.shinyAdvance == 0 && sp.firstSpawn.shiny) current.push_back(i);
-            else if (sp.shinyAdvance > 0 && sp.shinyAdvance <= NEAR_THRESHOLD) nearN.push_back(i);
-            else if (sp.shinyAdvance > NEAR_THRESHOLD) farN.push_back(i);
+            if (sps.speciesId[i] == 0) continue;  // skip story/placeholder spawners
+            int adv = sps.shinyAdvance[i];
+            if (sps.shinyNow(i)) current.push_back(i);
+            else if (adv > 0 && adv <= NEAR_THRESHOLD) nearN.push_back(i);
+            else if (adv > NEAR_THRESHOLD) farCount++;
         }
         std::sort(nearN.begin(), nearN.end(),
-                  [&](int a, int b){ return sps[a].shinyAdvance < sps[b].shinyAdvance; });
+                  [&](int a, int b){ return sps.shinyAdvance[a] < sps.shinyAdvance[b]; });
 
         char buf[96];
         std::snprintf(buf, sizeof(buf),
                       "Current: %zu    <%d adv: %zu    total: %zu",
                       current.size(), NEAR_THRESHOLD, nearN.size(),
-                      current.size() + nearN.size() + farN.size());
+                      current.size() + nearN.size() + farCount);
         list->addItem(new tsl::elm::ListItem(buf));
 
         auto addRow = [&](int idx) {
-            const auto& sp = sps[idx];
+            const PlaSpawner sp = s.reader.detail(sps, idx);
             char row[96];
             const char* species = sp.speciesName ? sp.speciesName : "?";
             const char* mark    = sp.alpha ? "a " : "  ";
@@ -159,6 +269,7 @@ public:
 
         list->addItem(new tsl::elm::CategoryHeader("X: teleport    B: back    Y: rescan"));
         frame->setContent(list);
+        sampleHeap();
         return frame;
     }
 
@@ -185,7 +296,7 @@ public:
         auto* frame = new tsl::elm::OverlayFrame("pkTeraRaid", "Legends Arceus Shiny Scanner");
         auto* list  = new tsl::elm::List();
 
-        if (!s.status.empty()) {
+        if (s.status[0]) {
             list->addItem(new tsl::elm::ListItem(s.status));
             list->addItem(new tsl::elm::CategoryHeader("Y: rescan"));
             frame->setContent(list);
@@ -196,7 +307,7 @@ public:
 
         for (int r = 0; r < (int)PlaRegion::Count; r++) {
             auto region = (PlaRegion)r;
-            RegionStats st = statsFor(region);
+            PlaRegionStats st = s.reader.regionStats(region);
             char label[128];
             std::snprintf(label, sizeof(label), "%s", plaRegionName(region));
             char value[64];
@@ -218,8 +329,11 @@ public:
             list->addItem(item);
         }
 
+        addBudgetItems(list);
+
         list->addItem(new tsl::elm::CategoryHeader("A: open    Y: rescan"));
         frame->setContent(list);
+        sampleHeap();
         return frame;
     }
 
@@ -234,11 +348,320 @@ public:
     }
 };
 
+class SvMapDetailsGui : public tsl::Gui {
+public:
+    explicit SvMapDetailsGui(TeraRaidMapParent map) : map_(map) {}
+
+    tsl::elm::Element* createUI() override {
+        auto& s = state();
+
+        auto* frame = new tsl::elm::OverlayFrame(svMapName(map_), "pkTeraRaid");
+        auto* list  = new tsl::elm::List();
+
+        if (s.status[0]) {
+            list->addItem(new tsl::elm::ListItem(s.status));
+            frame->setContent(list);
+            return frame;
+        }
+
+        SvMapStats st = s.sv.mapStats(map_);
+        char buf[96];
+        std::snprintf(buf, sizeof(buf), "Raids: %zu    shiny: %zu    6*: %zu    rare: %zu",
+                      st.total, st.shiny, st.black, st.rare);
+        list->addItem(new tsl::elm::ListItem(buf));
+
+        int top[TOP_N];
+        size_t n = s.sv.topRaids(map_, top, TOP_N);
+        if (n > 0) list->addItem(new tsl::elm::CategoryHeader("Top raids"));
+        for (size_t i = 0; i < n; i++) {
+            const SvRaid& r = s.sv.raids()[top[i]];
+            const char* shiny = r.shiny == TeraShiny::Square ? "  SQUARE"
+                              : r.shiny == TeraShiny::Star   ? "  SHINY" : "";
+            char row[96];
+            std::snprintf(row, sizeof(row), "%d* %s  %s%s", r.stars, r.encounter->name,
+                          SvRaidTables::TYPE_NAMES[r.teraType % 18], shiny);
+            auto* item = new tsl::elm::ListItem(row);
+            if (r.rareCount > 0) {
+                char value[48];
+                if (r.rareCount > 1)
+                    std::snprintf(value, sizeof(value), "%s +%d",
+                                  SvRaidTables::itemName(r.rareItem), r.rareCount - 1);
+                else
+                    std::snprintf(value, sizeof(value), "%s", SvRaidTables::itemName(r.rareItem));
+                item->setValue(value);
+            }
+            list->addItem(item);
+        }
+        if (n == 0)
+            list->addItem(new tsl::elm::ListItem("No raids on this map."));
+
+        list->addItem(new tsl::elm::CategoryHeader("B: back    Y: rescan"));
+        frame->setContent(list);
+        sampleHeap();
+        return frame;
+    }
+
+    bool handleInput(u64 keysDown, u64, const HidTouchState&,
+                     HidAnalogStickState, HidAnalogStickState) override {
+        if (keysDown & HidNpadButton_Y) {
+            performScan();
+            tsl::changeTo<SvMapDetailsGui>(map_);
+            return true;
+        }
+        return false;
+    }
+
+private:
+    TeraRaidMapParent map_;
+};
+
+class SvMapListGui : public tsl::Gui {
+public:
+    tsl::elm::Element* createUI() override {
+        auto& s = state();
+        if (!s.scanned) performScan();
+
+        auto* frame = new tsl::elm::OverlayFrame("pkTeraRaid", "Scarlet/Violet Raid Scanner");
+        auto* list  = new tsl::elm::List();
+
+        if (s.status[0]) {
+            list->addItem(new tsl::elm::ListItem(s.status));
+            list->addItem(new tsl::elm::CategoryHeader("Y: rescan"));
+            frame->setContent(list);
+            return frame;
+        }
+
+        list->addItem(new tsl::elm::CategoryHeader("Select map"));
+
+        for (TeraRaidMapParent map : SV_MAPS) {
+            SvMapStats st = s.sv.mapStats(map);
+            char value[64];
+            if (st.total == 0)
+                std::snprintf(value, sizeof(value), "empty");
+            else
+                std::snprintf(value, sizeof(value), "%zu raids, %zu shiny, %zu rare",
+                              st.total, st.shiny, st.rare);
+
+            auto* item = new tsl::elm::ListItem(svMapName(map));
+            item->setValue(value);
+            item->setClickListener([map](u64 keys) {
+                if (keys & HidNpadButton_A) {
+                    tsl::changeTo<SvMapDetailsGui>(map);
+                    return true;
+                }
+                return false;
+            });
+            list->addItem(item);
+        }
+
+        addBudgetItems(list);
+
+        list->addItem(new tsl::elm::CategoryHeader("A: open    Y: rescan"));
+        frame->setContent(list);
+        sampleHeap();
+        return frame;
+    }
+
+    bool handleInput(u64 keysDown, u64, const HidTouchState&,
+                     HidAnalogStickState, HidAnalogStickState) override {
+        if (keysDown & HidNpadButton_Y) {
+            performScan();
+            tsl::changeTo<SvMapListGui>();
+            return true;
+        }
+        return false;
+    }
+};
+
+// "Square in 12" / "Star now" / "none" / "..." while the search is pending.
+void formatDenShiny(const SwShDenInfo& den, char* buf, size_t size) {
+    if (!den.shinyKnown) {
+        std::snprintf(buf, size, "...");
+        return;
+    }
+    if (den.shinyType == SwShShinyType::None) {
+        std::snprintf(buf, size, "none");
+        return;
+    }
+    const char* kind = den.shinyType == SwShShinyType::Square ? "Square" : "Star";
+    if (den.shinyAdvance == 1)
+        std::snprintf(buf, size, "%s now", kind);
+    else
+        std::snprintf(buf, size, "%s in %u", kind, den.shinyAdvance);
+}
+
+void formatRegionSummary(const SwShRegionStats& st, char* buf, size_t size) {
+    if (st.pending > 0)
+        std::snprintf(buf, size, "%zu active, %zu <%u (%zu/%zu)", st.listed,
+                      st.shinyWithin, SWSH_NEAR_FRAMES, st.listed - st.pending, st.listed);
+    else
+        std::snprintf(buf, size, "%zu active, %zu <%u", st.listed, st.shinyWithin,
+                      SWSH_NEAR_FRAMES);
+}
+
+class SwShRegionDetailsGui : public tsl::Gui {
+public:
+    explicit SwShRegionDetailsGui(SwShDenRegion r) : region_(r) {}
+
+    tsl::elm::Element* createUI() override {
+        auto& s = state();
+
+        auto* frame = new tsl::elm::OverlayFrame(swshRegionName(region_), "pkTeraRaid");
+        auto* list  = new tsl::elm::List();
+
+        if (s.status[0]) {
+            list->addItem(new tsl::elm::ListItem(s.status));
+            frame->setContent(list);
+            return frame;
+        }
+
+        summary_ = new tsl::elm::ListItem("Dens");
+        list->addItem(summary_);
+
+        list->addItem(new tsl::elm::CategoryHeader("Active dens"));
+        const auto& dens = s.dens.dens();
+        rowCount_ = 0;
+        for (int i = 0; i < (int)dens.size() && rowCount_ < SWSH_MAX_REGION; i++) {
+            const SwShDenInfo& den = dens[i];
+            if (den.region != region_ || !den.isActive || den.species == 0) continue;  // as regionStats
+            const auto& loc = SwShDenLocations::DEN_LOCATIONS[den.denIndex];
+            char row[96];
+            std::snprintf(row, sizeof(row), "%s%d* %s  %s", den.isRare ? "r " : "  ",
+                          den.stars + 1, SpeciesNames::name(den.species),
+                          SwShDenLocations::LOCATION_NAMES[loc.locationId]);
+            rows_[rowCount_] = new tsl::elm::ListItem(row);
+            rowDen_[rowCount_] = i;
+            list->addItem(rows_[rowCount_]);
+            rowCount_++;
+        }
+        if (rowCount_ == 0)
+            list->addItem(new tsl::elm::ListItem("No active dens."));
+
+        list->addItem(new tsl::elm::CategoryHeader("B: back    Y: rescan"));
+        frame->setContent(list);
+        refresh();
+        sampleHeap();
+        return frame;
+    }
+
+    // Search this region's pending dens a few at a time, so the list is up
+    // at once and the values fill in.
+    void update() override {
+        if (state().status[0] || done_) return;
+        done_ = state().dens.predictPending(region_, SWSH_PREDICT_BUDGET) == 0;
+        refresh();
+    }
+
+    bool handleInput(u64 keysDown, u64, const HidTouchState&,
+                     HidAnalogStickState, HidAnalogStickState) override {
+        if (keysDown & HidNpadButton_Y) {
+            performScan();
+            tsl::changeTo<SwShRegionDetailsGui>(region_);
+            return true;
+        }
+        return false;
+    }
+
+private:
+    SwShDenRegion         region_;
+    tsl::elm::ListItem*   summary_ = nullptr;
+    tsl::elm::ListItem*   rows_[SWSH_MAX_REGION];
+    int                   rowDen_[SWSH_MAX_REGION];
+    size_t                rowCount_ = 0;
+    bool                  done_ = false;
+
+    void refresh() {
+        const auto& dens = state().dens.dens();
+        char buf[64];
+        formatRegionSummary(state().dens.regionStats(region_, SWSH_NEAR_FRAMES), buf, sizeof(buf));
+        summary_->setValue(buf);
+        for (size_t i = 0; i < rowCount_; i++) {
+            formatDenShiny(dens[rowDen_[i]], buf, sizeof(buf));
+            rows_[i]->setValue(buf);
+        }
+    }
+};
+
+class SwShRegionListGui : public tsl::Gui {
+public:
+    tsl::elm::Element* createUI() override {
+        auto& s = state();
+        if (!s.scanned) performScan();
+
+        auto* frame = new tsl::elm::OverlayFrame("pkTeraRaid", "Sword/Shield Den Scanner");
+        auto* list  = new tsl::elm::List();
+
+        if (s.status[0]) {
+            list->addItem(new tsl::elm::ListItem(s.status));
+            list->addItem(new tsl::elm::CategoryHeader("Y: rescan"));
+            frame->setContent(list);
+            return frame;
+        }
+
+        list->addItem(new tsl::elm::CategoryHeader("Select region"));
+
+        for (int r = 0; r < (int)std::size(SWSH_REGIONS); r++) {
+            SwShDenRegion region = SWSH_REGIONS[r];
+            items_[r] = new tsl::elm::ListItem(swshRegionName(region));
+            items_[r]->setClickListener([region](u64 keys) {
+                if (keys & HidNpadButton_A) {
+                    tsl::changeTo<SwShRegionDetailsGui>(region);
+                    return true;
+                }
+                return false;
+            });
+            list->addItem(items_[r]);
+        }
+
+        addBudgetItems(list);
+
+        list->addItem(new tsl::elm::CategoryHeader("A: open    Y: rescan"));
+        frame->setContent(list);
+        refresh();
+        sampleHeap();
+        return frame;
+    }
+
+    // Regions are searched in menu order, a few dens per frame.
+    void update() override {
+        auto& s = state();
+        if (s.status[0] || region_ >= (int)std::size(SWSH_REGIONS)) return;
+        if (s.dens.predictPending(SWSH_REGIONS[region_], SWSH_PREDICT_BUDGET) == 0) region_++;
+        refresh();
+    }
+
+    bool handleInput(u64 keysDown, u64, const HidTouchState&,
+                     HidAnalogStickState, HidAnalogStickState) override {
+        if (keysDown & HidNpadButton_Y) {
+            performScan();
+            tsl::changeTo<SwShRegionListGui>();
+            return true;
+        }
+        return false;
+    }
+
+private:
+    tsl::elm::ListItem* items_[std::size(SWSH_REGIONS)] = {};
+    int                 region_ = 0;   // next region to search
+
+    void refresh() {
+        for (int r = 0; r < (int)std::size(SWSH_REGIONS); r++) {
+            SwShRegionStats st = state().dens.regionStats(SWSH_REGIONS[r], SWSH_NEAR_FRAMES);
+            char value[64];
+            formatRegionSummary(st, value, sizeof(value));
+            items_[r]->setValue(value);
+        }
+    }
+};
+
 class PlaOverlay : public tsl::Overlay {
 public:
     void initServices() override {}
     void exitServices() override { DmntMem::exit(); }
     std::unique_ptr<tsl::Gui> loadInitialGui() override {
+        state().game = detectGame();
+        if (isSV(state().game)) return initially<SvMapListGui>();
+        if (isSwSh(state().game)) return initially<SwShRegionListGui>();
         return initially<RegionListGui>();
     }
 };
@@ -0,0 +1,169 @@
+#include "glyph_atlas.h"
+#include <algorithm>
+
+namespace {
+
+constexpr int PADDING = 1;
+constexpr uint32_t REPLACEMENT = 0xFFFD;
+
+} // namespace
+
+void GlyphAtlas::decode(const std::string& text) {
+    codepoints_.clear();
+    const auto* s = reinterpret_cast<const unsigned char*>(text.data());
+    size_t n = text.size();
+    for (size_t i = 0; i < n;) {
+        unsigned char c = s[i];
+        uint32_t cp;
+        int len;
+        if (c < 0x80)               { cp = c;        len = 1; }
+        else if ((c & 0xE0) == 0xC0) { cp = c & 0x1F; len = 2; }
+        else if ((c & 0xF0) == 0xE0) { cp = c & 0x0F; len = 3; }
+        else if ((c & 0xF8) == 0xF0) { cp = c & 0x07; len = 4; }
+        else { codepoints_.push_back(REPLACEMENT); i++; continue; }
+
+        if (i + len > n) { codepoints_.push_back(REPLACEMENT); break; }
+        bool ok = true;
+        for (int k = 1; k < len; k++) {
+            if ((s[i + k] & 0xC0) != 0x80) { ok = false; break; }
+            cp = (cp << 6) | (s[i + k] & 0x3F);
+        }
+        codepoints_.push_back(ok ? cp : REPLACEMENT);
+        i += ok ? len : 1;
+    }
+}
+
+GlyphAtlas::FontAtlas* GlyphAtlas::atlasFor(TTF_Font* font) {
+    auto it = fonts_.find(font);
+    if (it != fonts_.end()) return &it->second;
+
+    FontAtlas& fa = fonts_[font];
+    fa.tex = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_ARGB8888,
+                               SDL_TEXTUREACCESS_STATIC, ATLAS_SIZE, ATLAS_SIZE);
+    if (!fa.tex) {
+        fonts_.erase(font);
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(fa.tex, SDL_BLENDMODE_BLEND);
+    clearAtlas(fa);
+    return &fa;
+}
+
+void GlyphAtlas::clearAtlas(FontAtlas& fa) {
+    std::vector<uint32_t> zero((size_t)ATLAS_SIZE * ATLAS_SIZE, 0);
+    SDL_UpdateTexture(fa.tex, nullptr, zero.data(), ATLAS_SIZE * 4);
+    fa.glyphs.clear();
+    fa.shelfX = fa.shelfY = fa.shelfH = 0;
+}
+
+bool GlyphAtlas::place(FontAtlas& fa, int w, int h, SDL_Rect& out) {
+    if (w + PADDING > ATLAS_SIZE || h + PADDING > ATLAS_SIZE) return false;
+    if (fa.shelfX + w + PADDING > ATLAS_SIZE) {
+        fa.shelfY += fa.shelfH;
+        fa.shelfX = 0;
+        fa.shelfH = 0;
+    }
+    if (fa.shelfY + h + PADDING > ATLAS_SIZE) {
+        // Full: start over. Only glyphs still in use get rasterized again.
+        clearAtlas(fa);
+        fa.reset = true;
+    }
+    out = {fa.shelfX, fa.shelfY, w, h};
+    fa.shelfX += w + PADDING;
+    fa.shelfH = std::max(fa.shelfH, h + PADDING);
+    return true;
+}
+
+const GlyphAtlas::Glyph& GlyphAtlas::glyph(TTF_Font* font, FontAtlas& fa, uint32_t cp) {
+    auto it = fa.glyphs.find(cp);
+    if (it != fa.glyphs.end()) return it->second;
+
+    Glyph g;
+    int minx = 0, maxx = 0, miny = 0, maxy = 0, advance = 0;
+    if (TTF_GlyphMetrics32(font, cp, &minx, &maxx, &miny, &maxy, &advance) == 0) {
+        g.advance = advance;
+        // SDL_ttf shifts the cell right when the glyph overhangs the pen.
+        g.offsetX = std::min(0, minx);
+    }
+
+    // Rasterize in white; the vertex colour supplies the tint at draw time.
+    SDL_Surface* surf = TTF_RenderGlyph32_Blended(font, cp, SDL_Color{255, 255, 255, 255});
+    if (surf && surf->format->format != SDL_PIXELFORMAT_ARGB8888) {
+        SDL_Surface* conv = SDL_ConvertSurfaceFormat(surf, SDL_PIXELFORMAT_ARGB8888, 0);
+        SDL_FreeSurface(surf);
+        surf = conv;
+    }
+    if (surf) {
+        SDL_Rect rect;
+        if (place(fa, surf->w, surf->h, rect)) {
+            SDL_UpdateTexture(fa.tex, &rect, surf->pixels, surf->pitch);
+            g.src = rect;
+        }
+        SDL_FreeSurface(surf);
+    }
+    return fa.glyphs.emplace(cp, g).first->second;
+}
+
+int GlyphAtlas::measure(TTF_Font* font, const std::string& text) {
+    FontAtlas* fa = atlasFor(font);
+    if (!fa) return 0;
+    decode(text);
+    int pen = 0;
+    uint32_t prev = 0;
+    for (uint32_t cp : codepoints_) {
+        if (prev) pen += TTF_GetFontKerningSizeGlyphs32(font, prev, cp);
+        pen += glyph(font, *fa, cp).advance;
+        prev = cp;
+    }
+    return pen;
+}
+
+void GlyphAtlas::draw(TTF_Font* font, const std::string& text, int x, int y, SDL_Color color) {
+    FontAtlas* fa = atlasFor(font);
+    if (!fa) return;
+    decode(text);
+
+    // Make sure every glyph is resident first; if that wiped the atlas,
+    // rasterize again so all rects refer to the current contents.
+    fa->reset = false;
+    for (uint32_t cp : codepoints_) glyph(font, *fa, cp);
+    if (fa->reset) {
+        fa->reset = false;
+        for (uint32_t cp : codepoints_) glyph(font, *fa, cp);
+    }
+
+    verts_.clear();
+    indices_.clear();
+    const float inv = 1.0f / ATLAS_SIZE;
+    int pen = x;
+    uint32_t prev = 0;
+    for (uint32_t cp : codepoints_) {
+        if (prev) pen += TTF_GetFontKerningSizeGlyphs32(font, prev, cp);
+        prev = cp;
+        const Glyph& g = glyph(font, *fa, cp);
+        if (g.src.w > 0) {
+            float x0 = (float)(pen + g.offsetX), y0 = (float)y;
+            float x1 = x0 + g.src.w, y1 = y0 + g.src.h;
+            float u0 = g.src.x * inv, v0 = g.src.y * inv;
+            float u1 = (g.src.x + g.src.w) * inv, v1 = (g.src.y + g.src.h) * inv;
+            int base = (int)verts_.size();
+            verts_.push_back({{x0, y0}, color, {u0, v0}});
+            verts_.push_back({{x1, y0}, color, {u1, v0}});
+            verts_.push_back({{x1, y1}, color, {u1, v1}});
+            verts_.push_back({{x0, y1}, color, {u0, v1}});
+            int quad[6] = {base, base + 1, base + 2, base, base + 2, base + 3};
+            indices_.insert(indices_.end(), quad, quad + 6);
+        }
+        pen += g.advance;
+    }
+
+    if (!indices_.empty())
+        SDL_RenderGeometry(renderer_, fa->tex, verts_.data(), (int)verts_.size(),
+                           indices_.data(), (int)indices_.size());
+}
+
+void GlyphAtlas::free() {
+    for (auto& [font, fa] : fonts_)
+        if (fa.tex) SDL_DestroyTexture(fa.tex);
+    fonts_.clear();
+}
@@ -69,12 +69,16 @@ bool LocationData::loadJson(const std::string& path, std::unordered_map<std::str
 bool LocationData::load(const std::string& paldeaPath,
                         const std::string& kitakamiPath,
                         const std::string& blueberryPath) {
-    bool ok = loadJson(paldeaPath, paldea_);
-    loadJson(kitakamiPath, kitakami_);
-    loadJson(blueberryPath, blueberry_);
-    paldeaBounds_ = computeBounds(paldea_);
-    kitakamiBounds_ = computeBounds(kitakami_);
-    blueberryBounds_ = computeBounds(blueberry_);
+    bool ok = loadMap(TeraRaidMapParent::Paldea, paldeaPath);
+    loadMap(TeraRaidMapParent::Kitakami, kitakamiPath);
+    loadMap(TeraRaidMapParent::Blueberry, blueberryPath);
+    return ok;
+}
+
+bool LocationData::loadMap(TeraRaidMapParent map, const std::string& path) {
+    auto& m = getMapMut(map);
+    bool ok = loadJson(path, m);
+    getBoundsMut(map) = computeBounds(m);
     return ok;
 }
 
@@ -4,8 +4,10 @@
 #ifdef __SWITCH__
 #include <switch.h>
 #include "dmnt_mem.h"
+#include "memory_recorder.h"
 #endif
 
+#include <cstdio>
 #include <string>
 
 int main(int argc, char* argv[]) {
@@ -38,15 +40,60 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    ui.showSplash();
-
 #ifdef __SWITCH__
     AppletType at = appletGetAppletType();
     bool liveMode = (at != AppletType_Application && at != AppletType_SystemApplication);
 
+    // Detect the running game before the splash so its resources can load
+    // in the background while the splash is on screen.
+    bool dmntReady = false;
+    bool gameKnown = false;
+    GameVersion game = GameVersion::Scarlet;
+    if (liveMode) {
+        dmntReady = DmntMem::init();
+        if (dmntReady) {
+            uint64_t tid = DmntMem::titleId();
+            gameKnown = true;
+            if (tid == SCARLET_TITLE_ID) {
+                game = GameVersion::Scarlet;
+            } else if (tid == VIOLET_TITLE_ID) {
+                game = GameVersion::Violet;
+            } else if (tid == SWORD_TITLE_ID) {
+                game = GameVersion::Sword;
+            } else if (tid == SHIELD_TITLE_ID) {
+                game = GameVersion::Shield;
+            } else if (tid == PLA_TITLE_ID) {
+                game = GameVersion::LegendsArceus;
+            } else {
+                gameKnown = false;
+            }
+        }
+    }
+
+    // Dropping an empty "record_reads" file next to the .nro captures every
+    // live-mode memory read of the session to reads.pkrc for offline replay.
+    RecordingSource recorder(DmntMem::g_dmnt);
+    if (gameKnown) {
+        if (FILE* flag = fopen((basePath + "record_reads").c_str(), "rb")) {
+            fclose(flag);
+            if (recorder.open(basePath + "reads.pkrc"))
+                DmntMem::setSource(&recorder);
+        }
+    }
+    if (gameKnown)
+        ui.preload(game);
+    else if (!liveMode)
+        ui.preloadCommon();
+#else
+    ui.preloadCommon();
+#endif
+
+    ui.showSplash();
+
+#ifdef __SWITCH__
     if (liveMode) {
         // Applet mode: read from live game memory via dmntcht
-        if (!DmntMem::init()) {
+        if (!dmntReady) {
             ui.showMessageAndWait("dmntcht Error",
                                   "Could not connect to dmnt:cht.\n"
                                   "Make sure Atmosphere is running.");
@@ -55,19 +102,7 @@ int main(int argc, char* argv[]) {
             return 1;
         }
 
-        uint64_t tid = DmntMem::titleId();
-        GameVersion game;
-        if (tid == SCARLET_TITLE_ID) {
-            game = GameVersion::Scarlet;
-        } else if (tid == VIOLET_TITLE_ID) {
-            game = GameVersion::Violet;
-        } else if (tid == SWORD_TITLE_ID) {
-            game = GameVersion::Sword;
-        } else if (tid == SHIELD_TITLE_ID) {
-            game = GameVersion::Shield;
-        } else if (tid == PLA_TITLE_ID) {
-            game = GameVersion::LegendsArceus;
-        } else {
+        if (!gameKnown) {
             ui.showMessageAndWait("Wrong Game",
                                   "No supported game is running.\n"
                                   "Please launch Pokemon Sword, Shield,\n"
@@ -86,6 +121,7 @@ int main(int argc, char* argv[]) {
             ui.runLive(basePath, game);
         }
         DmntMem::exit();
+        recorder.close();
     } else {
         // Title override mode: read from save file
         ui.run(basePath);
@@ -0,0 +1,150 @@
+#include "memory_recorder.h"
+#include <cstring>
+
+namespace {
+
+constexpr size_t WRITE_BUFFER = 64 * 1024;
+
+void put16(uint8_t* p, uint16_t v) { std::memcpy(p, &v, 2); }
+void put32(uint8_t* p, uint32_t v) { std::memcpy(p, &v, 4); }
+void put64(uint8_t* p, uint64_t v) { std::memcpy(p, &v, 8); }
+uint16_t get16(const uint8_t* p) { uint16_t v; std::memcpy(&v, p, 2); return v; }
+uint32_t get32(const uint8_t* p) { uint32_t v; std::memcpy(&v, p, 4); return v; }
+uint64_t get64(const uint8_t* p) { uint64_t v; std::memcpy(&v, p, 8); return v; }
+
+} // namespace
+
+// --- Recording ---
+
+bool RecordingSource::open(const std::string& path) {
+    close();
+    file_ = fopen(path.c_str(), "wb");
+    if (!file_) return false;
+    buffer_.resize(WRITE_BUFFER);
+    setvbuf(file_, buffer_.data(), _IOFBF, buffer_.size());
+
+    uint8_t header[MemoryCapture::HEADER_SIZE] = {};
+    put32(header, MemoryCapture::MAGIC);
+    put16(header + 4, MemoryCapture::VERSION);
+    put64(header + 8, inner_.titleId());
+    put64(header + 16, inner_.mainBase());
+    put64(header + 24, inner_.heapBase());
+    if (fwrite(header, sizeof(header), 1, file_) != 1) {
+        close();
+        return false;
+    }
+    start_ = std::chrono::steady_clock::now();
+    return true;
+}
+
+void RecordingSource::close() {
+    if (file_) {
+        fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+void RecordingSource::append(MemoryCapture::Kind kind, uint64_t addr,
+                             const void* bytes, size_t size) {
+    if (!file_) return;
+    uint64_t micros = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_).count();
+    uint8_t rec[MemoryCapture::RECORD_HEADER_SIZE];
+    rec[0] = kind;
+    put32(rec + 1, (uint32_t)size);
+    put64(rec + 5, addr);
+    put64(rec + 13, micros);
+    fwrite(rec, sizeof(rec), 1, file_);
+    if (bytes) fwrite(bytes, 1, size, file_);
+}
+
+bool RecordingSource::read(uint64_t addr, void* buf, size_t size) {
+    bool ok = inner_.read(addr, buf, size);
+    if (ok) append(MemoryCapture::Read, addr, buf, size);
+    else    append(MemoryCapture::ReadFailed, addr, nullptr, size);
+    return ok;
+}
+
+bool RecordingSource::write(uint64_t addr, const void* buf, size_t size) {
+    bool ok = inner_.write(addr, buf, size);
+    append(ok ? MemoryCapture::Write : MemoryCapture::WriteFailed,
+           addr, ok ? buf : nullptr, size);
+    return ok;
+}
+
+// --- Replay ---
+
+bool ReplaySource::load(const std::string& path) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+
+    fseek(f, 0, SEEK_END);
+    long fileSize = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (fileSize < (long)MemoryCapture::HEADER_SIZE) { fclose(f); return false; }
+
+    std::vector<uint8_t> raw(fileSize);
+    size_t read = fread(raw.data(), 1, fileSize, f);
+    fclose(f);
+    if ((long)read != fileSize) return false;
+
+    const uint8_t* p = raw.data();
+    if (get32(p) != MemoryCapture::MAGIC || get16(p + 4) != MemoryCapture::VERSION)
+        return false;
+    titleId_  = get64(p + 8);
+    mainBase_ = get64(p + 16);
+    heapBase_ = get64(p + 24);
+
+    records_.clear();
+    data_.clear();
+    size_t pos = MemoryCapture::HEADER_SIZE;
+    // A capture cut short (app killed mid-write) keeps every complete record.
+    while (pos + MemoryCapture::RECORD_HEADER_SIZE <= raw.size()) {
+        Record r;
+        r.kind   = (MemoryCapture::Kind)p[pos];
+        r.size   = get32(p + pos + 1);
+        r.addr   = get64(p + pos + 5);
+        r.micros = get64(p + pos + 13);
+        pos += MemoryCapture::RECORD_HEADER_SIZE;
+
+        bool hasBytes = r.kind == MemoryCapture::Read || r.kind == MemoryCapture::Write;
+        size_t n = hasBytes ? r.size : 0;
+        if (pos + n > raw.size()) break;
+        r.offset = data_.size();
+        data_.insert(data_.end(), raw.begin() + pos, raw.begin() + pos + n);
+        pos += n;
+        records_.push_back(r);
+    }
+    cursor_ = 0;
+    misses_ = 0;
+    return true;
+}
+
+const ReplaySource::Record* ReplaySource::next(bool isRead, uint64_t addr, size_t size) {
+    // Scan forward from the cursor, then wrap once, so replays stay in capture
+    // order but tolerate a reader that skips or repeats a read.
+    size_t n = records_.size();
+    for (size_t step = 0; step < n; step++) {
+        size_t i = (cursor_ + step) % n;
+        const Record& r = records_[i];
+        bool kindRead = r.kind == MemoryCapture::Read || r.kind == MemoryCapture::ReadFailed;
+        if (kindRead != isRead || r.addr != addr || r.size != size) continue;
+        cursor_ = i + 1;
+        return &r;
+    }
+    misses_++;
+    return nullptr;
+}
+
+bool ReplaySource::read(uint64_t addr, void* buf, size_t size) {
+    const Record* r = next(true, addr, size);
+    if (!r || r->kind != MemoryCapture::Read) return false;
+    std::memcpy(buf, data_.data() + r->offset, size);
+    return true;
+}
+
+bool ReplaySource::write(uint64_t addr, const void* buf, size_t size) {
+    (void)buf;
+    const Record* r = next(false, addr, size);
+    return r && r->kind == MemoryCapture::Write;
+}
@@ -0,0 +1,125 @@
+#include "memory_source.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+bool readExact(FILE* f, void* buf, size_t size) {
+    return fread(buf, 1, size, f) == size;
+}
+
+} // namespace
+
+bool FileMemorySource::load(const std::string& path) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    fseek(f, 0, SEEK_END);
+    long fileSize = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    uint32_t magic = 0;
+    uint16_t version = 0, count = 0;
+    uint64_t ids[3] = {};
+    bool ok = readExact(f, &magic, 4) && readExact(f, &version, 2) &&
+              readExact(f, &count, 2) && readExact(f, ids, sizeof(ids)) &&
+              magic == MAGIC && version == VERSION;
+
+    std::vector<Segment> segments;
+    for (uint16_t i = 0; ok && i < count; i++) {
+        uint64_t base = 0, size = 0;
+        ok = readExact(f, &base, 8) && readExact(f, &size, 8);
+        // A corrupt size must fail the load, not the allocation below.
+        if (ok) ok = size <= (uint64_t)(fileSize - ftell(f));
+        if (!ok) break;
+        Segment seg{base, std::vector<uint8_t>(size)};
+        ok = readExact(f, seg.bytes.data(), size);
+        segments.push_back(std::move(seg));
+    }
+    fclose(f);
+    if (!ok) return false;
+
+    setIdentity(ids[0], ids[1], ids[2]);
+    segments_.clear();
+    for (auto& seg : segments) addSegment(seg.base, std::move(seg.bytes));
+    return true;
+}
+
+bool FileMemorySource::save(const std::string& path) const {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+
+    uint32_t magic = MAGIC;
+    uint16_t version = VERSION;
+    uint16_t count = (uint16_t)segments_.size();
+    uint64_t ids[3] = {titleId_, mainBase_, heapBase_};
+    bool ok = fwrite(&magic, 4, 1, f) == 1 && fwrite(&version, 2, 1, f) == 1 &&
+              fwrite(&count, 2, 1, f) == 1 && fwrite(ids, sizeof(ids), 1, f) == 1;
+    for (const auto& seg : segments_) {
+        if (!ok) break;
+        uint64_t size = seg.bytes.size();
+        ok = fwrite(&seg.base, 8, 1, f) == 1 && fwrite(&size, 8, 1, f) == 1 &&
+             fwrite(seg.bytes.data(), 1, size, f) == size;
+    }
+    fclose(f);
+    return ok;
+}
+
+void FileMemorySource::setIdentity(uint64_t titleId, uint64_t mainBase, uint64_t heapBase) {
+    titleId_ = titleId;
+    mainBase_ = mainBase;
+    heapBase_ = heapBase;
+}
+
+void FileMemorySource::addSegment(uint64_t base, std::vector<uint8_t> bytes) {
+    auto it = std::upper_bound(segments_.begin(), segments_.end(), base,
+        [](uint64_t b, const Segment& s) { return b < s.base; });
+    segments_.insert(it, Segment{base, std::move(bytes)});
+}
+
+FileMemorySource::Segment* FileMemorySource::segmentAt(uint64_t addr) {
+    auto it = std::upper_bound(segments_.begin(), segments_.end(), addr,
+        [](uint64_t a, const Segment& s) { return a < s.base; });
+    if (it == segments_.begin()) return nullptr;
+    --it;
+    if (addr - it->base >= it->bytes.size()) return nullptr;
+    return &*it;
+}
+
+bool FileMemorySource::read(uint64_t addr, void* buf, size_t size) {
+    auto* out = static_cast<uint8_t*>(buf);
+    // A read may run across adjacent segments.
+    while (size > 0) {
+        Segment* seg = segmentAt(addr);
+        if (!seg) return false;
+        size_t off = addr - seg->base;
+        size_t n = std::min(size, seg->bytes.size() - off);
+        std::memcpy(out, seg->bytes.data() + off, n);
+        out += n;
+        addr += n;
+        size -= n;
+    }
+    return true;
+}
+
+bool FileMemorySource::write(uint64_t addr, const void* buf, size_t size) {
+    // Check the whole range first so a failed write leaves the image untouched.
+    for (uint64_t a = addr, left = size; left > 0;) {
+        Segment* seg = segmentAt(a);
+        if (!seg) return false;
+        size_t n = std::min<uint64_t>(left, seg->bytes.size() - (a - seg->base));
+        a += n;
+        left -= n;
+    }
+    const auto* in = static_cast<const uint8_t*>(buf);
+    while (size > 0) {
+        Segment* seg = segmentAt(addr);
+        size_t off = addr - seg->base;
+        size_t n = std::min(size, seg->bytes.size() - off);
+        std::memcpy(seg->bytes.data() + off, in, n);
+        in += n;
+        addr += n;
+        size -= n;
+    }
+    return true;
+}
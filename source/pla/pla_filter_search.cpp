@@ -0,0 +1,146 @@
+#include "pla/pla_filter_search.h"
+#include "pla/pla_markers.h"
+#include "thread_util.h"
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+namespace PlaFilterSearch {
+namespace {
+
+// Inclusive range of raw slot rolls that resolve to accepted slots.
+struct SlotRange { uint64_t lo, hi; };
+
+// A filter specialised for one job: only the checks it needs, in RNG order.
+struct Compiled {
+    bool    anySlot;
+    std::vector<SlotRange> slots;   // merged, ascending; used unless anySlot
+    bool    needFixed;              // anything beyond the slot to check
+    bool    shiny;
+    int     rolls;
+    int     guaranteedIvs;
+    bool    checkIvs;
+    uint8_t ivMin[6], ivMax[6];
+    int     nature;                 // -1 = any
+};
+
+bool slotAccepted(const Filter& f, const PlaMarkers::SlotEntry& e) {
+    if (f.speciesId != 0 && e.speciesId != f.speciesId) return false;
+    if (f.alpha >= 0 && e.alpha != (f.alpha != 0)) return false;
+    return true;
+}
+
+// First raw roll whose slot value floor(raw * total / 2^64) reaches `cum`
+// (2^64 when it never does) - the inverse of resolveSlotRaw.
+unsigned __int128 rawThreshold(uint32_t cum, uint32_t total) {
+    return (((unsigned __int128)cum << 64) + total - 1) / total;
+}
+
+// False when nothing can match, so the job needn't walk at all.
+bool compile(const Filter& f, const Job& job, Compiled& c) {
+    c.anySlot = f.speciesId == 0 && f.alpha < 0;
+    if (!c.anySlot) {
+        const PlaMarkers::Marker* m = job.marker;
+        if (!m || m->slotCount == 0 || m->slotTotal == 0) return false;
+        unsigned __int128 lo = 0;
+        for (int i = 0; i < m->slotCount; i++) {
+            unsigned __int128 hi =
+                rawThreshold(PlaMarkers::SLOT_CUMULATIVE[m->slotOffset + i], m->slotTotal);
+            if (hi > lo && slotAccepted(f, PlaMarkers::SLOTS[m->slotOffset + i])) {
+                if (!c.slots.empty() && c.slots.back().hi + 1 == (uint64_t)lo)
+                    c.slots.back().hi = (uint64_t)(hi - 1);
+                else
+                    c.slots.push_back({(uint64_t)lo, (uint64_t)(hi - 1)});
+            }
+            lo = hi;
+        }
+        if (c.slots.empty()) return false;
+    }
+
+    c.shiny = f.shiny;
+    c.rolls = job.shinyRolls;
+    c.guaranteedIvs = std::clamp(job.guaranteedIvs, 0, 6);
+    c.checkIvs = false;
+    for (int i = 0; i < 6; i++) {
+        c.ivMin[i] = f.ivMin[i];
+        c.ivMax[i] = std::min<uint8_t>(f.ivMax[i], 31);
+        if (c.ivMin[i] > c.ivMax[i]) return false;
+        if (c.ivMin[i] > 0 || c.ivMax[i] < 31) c.checkIvs = true;
+    }
+    c.nature = (f.nature >= 0 && f.nature < 25) ? f.nature : -1;
+    c.needFixed = c.shiny || c.checkIvs || c.nature >= 0;
+    return true;
+}
+
+inline bool slotMatches(const Compiled& c, uint64_t slotRaw) {
+    for (const SlotRange& r : c.slots) {
+        if (slotRaw < r.lo) return false;
+        if (slotRaw <= r.hi) return true;
+    }
+    return false;
+}
+
+// generateFromSeed, stopping at the first check that fails.
+bool fixedMatches(const Compiled& c, uint64_t fixedSeed) {
+    Xoroshiro128Plus rng(fixedSeed);
+    rng.nextInt(0xFFFFFFFFULL);             // EC
+    uint32_t sidtid = static_cast<uint32_t>(rng.nextInt(0xFFFFFFFFULL));
+    uint32_t tsv = (sidtid >> 16) ^ (sidtid & 0xFFFF);
+    bool shiny = false;
+    for (int i = 0; i < c.rolls; i++) {
+        uint32_t pid = static_cast<uint32_t>(rng.nextInt(0xFFFFFFFFULL));
+        if (((pid >> 16) ^ (pid & 0xFFFF) ^ tsv) < 0x10) { shiny = true; break; }
+    }
+    if (c.shiny && !shiny) return false;
+    if (!c.checkIvs && c.nature < 0) return true;
+
+    int ivs[6] = {-1, -1, -1, -1, -1, -1};
+    for (int i = 0; i < c.guaranteedIvs; i++) {
+        int idx = (int)rng.nextInt(6);
+        while (ivs[idx] != -1) idx = (int)rng.nextInt(6);
+        if (c.ivMax[idx] < 31) return false;
+        ivs[idx] = 31;
+    }
+    for (int i = 0; i < 6; i++) {
+        if (ivs[i] != -1) continue;
+        int iv = (int)rng.nextInt(32);
+        if (iv < c.ivMin[i] || iv > c.ivMax[i]) return false;
+    }
+    if (c.nature < 0) return true;
+    rng.nextInt(2);                         // ability
+    rng.nextInt(252);                       // gender
+    return (int)rng.nextInt(25) == c.nature;
+}
+
+int searchOne(const Job& job, const Filter& filter, const Options& opt) {
+    Compiled c;
+    if (!compile(filter, job, c)) return -1;
+    uint64_t group = job.groupSeed;
+    for (uint32_t adv = 0; adv <= opt.maxAdvance; adv++) {
+        if (ThreadUtil::cancelPoll(opt.cancel, adv)) return -1;
+        Xoroshiro128Plus main(group);
+        uint64_t gen = main.next();
+        main.next();                        // spawner 1's seed, unused
+        group = main.next();                // reseed: (r, CONST)
+
+        Xoroshiro128Plus spawner(gen);
+        uint64_t slotRaw = spawner.next();
+        if (!c.anySlot && !slotMatches(c, slotRaw)) continue;
+        if (!c.needFixed || fixedMatches(c, spawner.next())) return (int)adv;
+    }
+    return -1;
+}
+
+} // anonymous
+
+void run(const Job* jobs, size_t count, const Filter& filter, const Options& options,
+         int* out) {
+    Options opt = options;
+    opt.maxAdvance = std::min<uint32_t>(opt.maxAdvance, INT_MAX - 1);  // fits the int result
+    for (size_t j = 0; j < count; j++) out[j] = -1;
+    ThreadUtil::parallelFor(count, opt.threads,
+                            [&](size_t j) { out[j] = searchOne(jobs[j], filter, opt); },
+                            opt.cancel);
+}
+
+} // namespace PlaFilterSearch
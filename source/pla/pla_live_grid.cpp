@@ -0,0 +1,86 @@
+#include "pla/pla_live_grid.h"
+#include <algorithm>
+#include <cmath>
+
+int PlaLiveGrid::cellX(float x) const {
+    return std::clamp((int)((x - minX_) / cell_), 0, cols_ - 1);
+}
+
+int PlaLiveGrid::cellZ(float z) const {
+    return std::clamp((int)((z - minZ_) / cell_), 0, rows_ - 1);
+}
+
+void PlaLiveGrid::build(const PlaLivePos* positions, size_t count, float cellSize) {
+    positions_ = positions;
+    cellStart_.clear();
+    items_.clear();
+    cols_ = rows_ = 0;
+    count = std::min(count, PlaConfig::MAX_POSITIONS);
+
+    float maxX = 0.0f, maxZ = 0.0f;
+    bool any = false;
+    for (size_t i = 0; i < count; i++) {
+        const auto& p = positions[i];
+        if (!std::isfinite(p.x) || !std::isfinite(p.z)) continue;
+        if (!any) {
+            minX_ = maxX = p.x;
+            minZ_ = maxZ = p.z;
+            any = true;
+            continue;
+        }
+        minX_ = std::min(minX_, p.x); maxX = std::max(maxX, p.x);
+        minZ_ = std::min(minZ_, p.z); maxZ = std::max(maxZ, p.z);
+    }
+    if (!any) return;
+
+    float extent = std::max(maxX - minX_, maxZ - minZ_);
+    // extent / (cells - 1) keeps the +1 below within MAX_CELLS_PER_AXIS.
+    cell_ = std::max(cellSize, extent / (MAX_CELLS_PER_AXIS - 1));
+    cols_ = std::min((int)((maxX - minX_) / cell_) + 1, MAX_CELLS_PER_AXIS);
+    rows_ = std::min((int)((maxZ - minZ_) / cell_) + 1, MAX_CELLS_PER_AXIS);
+
+    // Counting sort by cell: count, prefix-sum, scatter.
+    cellOf_.assign(count, UINT32_MAX);
+    cellStart_.assign((size_t)cols_ * rows_ + 1, 0);
+    for (size_t i = 0; i < count; i++) {
+        const auto& p = positions[i];
+        if (!std::isfinite(p.x) || !std::isfinite(p.z)) continue;
+        cellOf_[i] = (uint32_t)(cellZ(p.z) * cols_ + cellX(p.x));
+        cellStart_[cellOf_[i] + 1]++;
+    }
+    for (size_t c = 1; c < cellStart_.size(); c++) cellStart_[c] += cellStart_[c - 1];
+
+    items_.resize(cellStart_.back());
+    fill_.assign(cellStart_.begin(), cellStart_.end() - 1);
+    for (size_t i = 0; i < count; i++) {
+        if (cellOf_[i] != UINT32_MAX) items_[fill_[cellOf_[i]]++] = (uint32_t)i;
+    }
+}
+
+const PlaLivePos* PlaLiveGrid::nearest(float x, float z, float radius) const {
+    if (!positions_ || cols_ == 0) return nullptr;
+    // Entirely outside the occupied area (plus radius): nothing can match.
+    if (x + radius < minX_ || z + radius < minZ_ ||
+        x - radius > minX_ + cols_ * cell_ || z - radius > minZ_ + rows_ * cell_)
+        return nullptr;
+
+    const PlaLivePos* best = nullptr;
+    float bestD2 = radius * radius;
+    int x0 = cellX(x - radius), x1 = cellX(x + radius);
+    int z0 = cellZ(z - radius), z1 = cellZ(z + radius);
+    for (int cz = z0; cz <= z1; cz++) {
+        for (int cx = x0; cx <= x1; cx++) {
+            size_t c = (size_t)cz * cols_ + cx;
+            for (uint32_t k = cellStart_[c]; k < cellStart_[c + 1]; k++) {
+                const PlaLivePos& p = positions_[items_[k]];
+                float dx = p.x - x, dz = p.z - z;
+                float d2 = dx * dx + dz * dz;
+                if (d2 <= bestD2) {
+                    bestD2 = d2;
+                    best = &p;
+                }
+            }
+        }
+    }
+    return best;
+}
@@ -0,0 +1,136 @@
+#include "pla/pla_outbreak_path.h"
+#include "thread_util.h"
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+namespace PlaOutbreakPath {
+namespace {
+
+// One search state: the respawn RNG seed plus how it was reached.
+struct Node {
+    uint64_t seed;
+    int      parent;    // index into the node arena, -1 for the root
+    uint8_t  clear;     // Pokemon cleared by the action that led here
+    uint8_t  left;      // replacements still available
+    uint8_t  cleared;   // total cleared along the path
+};
+
+// Everything any action from one state can produce. Clearing k spawns the
+// first k of the same replacement sequence, so one pass covers every k.
+struct Expansion {
+    int      firstShiny;              // index of the first shiny replacement, -1 if none
+    uint64_t fixedSeed[MAX_CLEAR];
+    uint64_t reseed[MAX_CLEAR];       // [k - 1]: respawn seed after clearing k
+};
+
+// Fixed seed of a spawn from its generator seed (the slot roll comes first).
+inline uint64_t fixedSeedOf(uint64_t generatorSeed) {
+    Xoroshiro128Plus fixed(generatorSeed);
+    fixed.next();
+    return fixed.next();
+}
+
+Expansion expand(uint64_t seed, int maxClear, int rolls) {
+    Expansion e{};
+    e.firstShiny = -1;
+    uint64_t draw[2 * MAX_CLEAR + 1];
+    Xoroshiro128Plus rng(seed);
+    for (int i = 0; i <= 2 * maxClear; i++) draw[i] = rng.next();
+    for (int i = 0; i < maxClear; i++) {
+        e.fixedSeed[i] = fixedSeedOf(draw[2 * i]);   // draw 2i+1: spawner 1, unused
+        e.reseed[i] = draw[2 * i + 2];
+        if (e.firstShiny < 0 &&
+            PlaEncounter::generateFromSeed(e.fixedSeed[i], rolls, 0).shiny)
+            e.firstShiny = i;
+    }
+    return e;
+}
+
+// Below this many states per thread, spawning costs more than it saves.
+constexpr size_t MIN_PER_THREAD = 64;
+
+} // anonymous
+
+Result search(uint64_t groupSeed, int spawnCount, const Options& options) {
+    Result res{};
+    res.found = false;
+    const int rolls = options.shinyRolls;
+
+    // Initial spawns straight from the group seed.
+    Xoroshiro128Plus main(groupSeed);
+    for (int i = 0; i < INIT_SPAWNS; i++) {
+        uint64_t generatorSeed = main.next();
+        main.next();                        // spawner 1's seed, unused
+        PlaEncounter::Fixed f = PlaEncounter::generateFromSeed(fixedSeedOf(generatorSeed),
+                                                               rolls, 0);
+        if (f.shiny) {
+            res.found = true;
+            res.spawnIndex = i;
+            res.pokemon = f;
+            return res;
+        }
+    }
+
+    int left = std::clamp(spawnCount - INIT_SPAWNS, 0, MAX_ACTIONS);
+    std::vector<Node> nodes{{main.next(), -1, 0, (uint8_t)left, 0}};
+    std::vector<int> frontier{0}, nextFrontier;
+    std::vector<Expansion> expansions;
+    // Seen states per replacements-left count; at equal depth the same state
+    // always has the same cleared total, and the first one seen (frontier
+    // order is path order) is the lexicographically smaller path.
+    std::unordered_set<uint64_t> seen[MAX_ACTIONS + 1];
+
+    for (int depth = 1; !frontier.empty(); depth++) {
+        expansions.resize(frontier.size());
+        int threads = std::min(options.threads, (int)(frontier.size() / MIN_PER_THREAD));
+        ThreadUtil::parallelFor(frontier.size(), threads, [&](size_t i) {
+            const Node& n = nodes[frontier[i]];
+            expansions[i] = expand(n.seed, std::min<int>(MAX_CLEAR, n.left), rolls);
+        });
+        res.states += frontier.size();
+
+        // A hit at this depth is the shortest; clearing just up to the shiny
+        // is the cheapest way to reach it from that state.
+        int best = -1, bestCleared = 0;
+        for (size_t i = 0; i < frontier.size(); i++) {
+            int s = expansions[i].firstShiny;
+            if (s < 0) continue;
+            int cleared = nodes[frontier[i]].cleared + s + 1;
+            if (best < 0 || cleared < bestCleared) {
+                best = (int)i;
+                bestCleared = cleared;
+            }
+        }
+        if (best >= 0) {
+            const Expansion& e = expansions[best];
+            res.found = true;
+            res.actions = depth;
+            res.spawnIndex = e.firstShiny;
+            res.pokemon = PlaEncounter::generateFromSeed(e.fixedSeed[e.firstShiny], rolls, 0);
+            res.path[depth - 1] = (uint8_t)(e.firstShiny + 1);
+            int step = depth - 2;
+            for (int n = frontier[best]; nodes[n].parent >= 0; n = nodes[n].parent)
+                res.path[step--] = nodes[n].clear;
+            return res;
+        }
+
+        // Children. A state with no replacements left can't spawn a shiny.
+        nextFrontier.clear();
+        for (size_t i = 0; i < frontier.size(); i++) {
+            Node parent = nodes[frontier[i]];
+            for (int k = 1; k <= std::min<int>(MAX_CLEAR, parent.left); k++) {
+                int childLeft = parent.left - k;
+                uint64_t seed = expansions[i].reseed[k - 1];
+                if (childLeft == 0 || !seen[childLeft].insert(seed).second) continue;
+                nextFrontier.push_back((int)nodes.size());
+                nodes.push_back({seed, frontier[i], (uint8_t)k, (uint8_t)childLeft,
+                                 (uint8_t)(parent.cleared + k)});
+            }
+        }
+        frontier.swap(nextFrontier);
+    }
+    return res;
+}
+
+} // namespace PlaOutbreakPath
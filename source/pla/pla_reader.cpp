@@ -1,12 +1,19 @@
 #include "pla/pla_reader.h"
 #include "pla/pla_markers.h"
+#include "pla/pla_shiny_search.h"
 #include "dmnt_mem.h"
 #include "xoroshiro128plus.h"
+#include <algorithm>
 #include <cstring>
 #include <cstdio>
 
 namespace {
 
+// Bulk reads are split into chunks of this size; a failed chunk marks the end
+// of readable memory (the array can sit near the end of its mapping).
+constexpr size_t READ_CHUNK = 0x10000;
+constexpr size_t READ_PROBE = 8;      // readSpan's prefix granularity
+
 bool readAt(const uint64_t* base, int baseLen, uint64_t tail, uint8_t* buf, size_t size) {
     uint64_t chain[8];
     if (baseLen + 1 > (int)(sizeof(chain) / sizeof(chain[0]))) return false;
@@ -15,135 +22,356 @@ bool readAt(const uint64_t* base, int baseLen, uint64_t tail, uint8_t* buf, size
     return DmntMem::readBlock(chain, baseLen + 1, buf, size);
 }
 
-bool readU64(const uint64_t* base, int baseLen, uint64_t tail, uint64_t& out) {
-    uint8_t buf[8];
-    if (!readAt(base, baseLen, tail, buf, 8)) return false;
-    std::memcpy(&out, buf, 8);
-    return true;
+// Walk base + {tail} once and return the address it lands on.
+bool resolveAt(const uint64_t* base, int baseLen, uint64_t tail, uint64_t& out) {
+    uint64_t chain[8];
+    if (baseLen + 1 > (int)(sizeof(chain) / sizeof(chain[0]))) return false;
+    for (int i = 0; i < baseLen; i++) chain[i] = base[i];
+    chain[baseLen] = tail;
+    return DmntMem::resolveChain(chain, baseLen + 1, out);
 }
 
-bool readU32(const uint64_t* base, int baseLen, uint64_t tail, uint32_t& out) {
-    uint8_t buf[4];
-    if (!readAt(base, baseLen, tail, buf, 4)) return false;
-    std::memcpy(&out, buf, 4);
-    return true;
+// Readable prefix of a chunk whose full read failed, to READ_PROBE bytes:
+// halve the probe on each failure, keep what succeeds.
+size_t readPrefix(uint64_t addr, uint8_t* out, size_t size) {
+    size_t done = 0;
+    for (size_t step = size / 2; step >= READ_PROBE && done < size;) {
+        size_t n = std::min(step, size - done);
+        if (DmntMem::readAbsolute(addr + done, out + done, n))
+            done += n;
+        else
+            step /= 2;
+    }
+    return done;
+}
+
+// Copy [addr, addr + span) into out. Returns the number of leading bytes
+// that were read successfully; a failed chunk still contributes the part
+// before the first unreadable byte.
+template <class Buffer>
+size_t readSpan(uint64_t addr, size_t span, Buffer& out) {
+    out.resize(span);
+    span = out.size();  // a fixed-capacity buffer may hold less
+    size_t done = 0;
+    while (done < span) {
+        size_t n = std::min(READ_CHUNK, span - done);
+        if (!DmntMem::readAbsolute(addr + done, out.data() + done, n))
+            return done + readPrefix(addr + done, out.data() + done, n);
+        done += n;
+    }
+    return done;
 }
 
-bool readFloat3(const uint64_t* base, int baseLen, uint64_t tail, float out[3]) {
-    uint8_t buf[12];
-    if (!readAt(base, baseLen, tail, buf, 12)) return false;
-    std::memcpy(out, buf, 12);
+template <typename T, class Buffer>
+bool parseAt(const Buffer& buf, size_t valid, uint64_t off, T& out) {
+    if (off + sizeof(T) > valid) return false;
+    std::memcpy(&out, buf.data() + off, sizeof(T));
     return true;
 }
 
+// Spawn count of the first populated outbreak slot; false when none is.
+bool readOutbreakCount(uint8_t& count) {
+    using namespace PlaPointers;
+    // Four outbreak slots, 0x50 apart, spawn count byte at +0x60.
+    uint8_t slots[0x60 + 3 * 0x50 + 1];
+    if (!readAt(OUTBREAK_BASE, OUTBREAK_BASE_LEN, 0, slots, sizeof(slots))) return false;
+    for (int i = 0; i < 4; i++) {
+        uint8_t c = slots[0x60 + i * 0x50];
+        if (c >= 10 && c <= 15) {
+            count = c;
+            return true;
+        }
+    }
+    return false;
+}
+
+// The outbreak is the highest group id with a non-zero active seed.
+template <class Buffer>
+bool findOutbreakGroup(const Buffer& buf, size_t valid, PlaOutbreak& ob) {
+    using namespace PlaPointers;
+    for (int gid = (int)PlaConfig::MAX_GROUPS - 1; gid >= 0; gid--) {
+        uint64_t activeSeed = 0;
+        if (!parseAt(buf, valid, POS_POSITION + gid * GROUP_STRIDE + GROUP_ACTIVE_SEED,
+                     activeSeed))
+            continue;
+        if (activeSeed != 0) {
+            uint64_t genSeed = 0;
+            parseAt(buf, valid, POS_POSITION + gid * GROUP_STRIDE + GROUP_GEN_SEED, genSeed);
+            ob.groupId = gid;
+            ob.groupSeed = genSeed - Xoroshiro128Plus::XOROSHIRO_CONST;
+            return true;
+        }
+    }
+    return false;
+}
+
 } // anonymous
 
+void PlaSpawnerTable::clear() {
+    groupId.clear();
+    groupSeed.clear();
+    region.clear();
+    shinyAdvance.clear();
+    flags.clear();
+    markerX.clear();
+    markerZ.clear();
+    speciesId.clear();
+    slot.clear();
+}
+
+void PlaSpawnerTable::reserve(size_t n) {
+    groupId.reserve(n);
+    groupSeed.reserve(n);
+    region.reserve(n);
+    shinyAdvance.reserve(n);
+    flags.reserve(n);
+    markerX.reserve(n);
+    markerZ.reserve(n);
+    speciesId.reserve(n);
+    slot.reserve(n);
+}
+
+void PlaSpawnerTable::pushRaw(int gid, uint64_t seed) {
+    groupId.push_back((int16_t)gid);
+    groupSeed.push_back(seed);
+    region.push_back(-1);
+    shinyAdvance.push_back(-1);
+    flags.push_back(0);
+    markerX.push_back(0.0f);
+    markerZ.push_back(0.0f);
+    speciesId.push_back(0);
+    slot.push_back(NO_SLOT);
+}
+
 bool PlaReader::readLive(int maxGroups) {
-    spawners_.clear();
-    livePositions_.clear();
+    clearRegionCache();
+    if (!scan(maxGroups, spawners_, livePositions_, trackedSeeds_)) return false;
+    liveGrid_.build(livePositions_.data(), livePositions_.size(), ACTIVE_RADIUS);
+    trackedPositions_ = livePositions_;
+    return true;
+}
+
+bool PlaReader::pollLive(PlaScan& out, int maxGroups) {
+    PlaGroupList<uint64_t> seeds;
+    if (!scan(maxGroups, out.spawners, out.livePositions, seeds, &out.outbreak)) return false;
+
+    bool sameSeeds = seeds == trackedSeeds_;
+    bool samePositions = out.livePositions.size() == trackedPositions_.size() &&
+        std::memcmp(out.livePositions.data(), trackedPositions_.data(),
+                    out.livePositions.size() * sizeof(PlaLivePos)) == 0;
+    if (sameSeeds && samePositions && out.outbreak == trackedOutbreak_) return false;
+
+    trackedSeeds_.swap(seeds);
+    trackedPositions_ = out.livePositions;
+    trackedOutbreak_ = out.outbreak;
+    return true;
+}
+
+void PlaReader::applyScan(PlaScan&& scan) {
+    clearRegionCache();
+    spawners_ = std::move(scan.spawners);
+    livePositions_ = std::move(scan.livePositions);
+    liveGrid_.build(livePositions_.data(), livePositions_.size(), ACTIVE_RADIUS);
+}
+
+void PlaReader::clearRegionCache() {
+    for (auto& cache : regions_) {
+        cache.spawners.clear();
+        cache.stats = {};
+    }
+}
+
+bool PlaReader::scan(int maxGroups, PlaSpawnerTable& spawners,
+                     PlaPositionList& positions, PlaGroupList<uint64_t>& seeds,
+                     PlaOutbreak* outbreak) {
+    maxGroups = std::clamp(maxGroups, 0, (int)PlaConfig::MAX_GROUPS);
+    spawners.clear();
+    positions.clear();
+    seeds.assign(maxGroups, 0);
+    if (outbreak) *outbreak = {};
 
     using namespace PlaPointers;
+    DmntMem::Session session;
+
+    // Resolve [[main+42a6ee0]+330] once; everything below is relative to it.
+    uint64_t base = 0;
+    if (!resolveAt(SPAWNER_BASE, SPAWNER_BASE_LEN, 0, base)) return true;
 
     // Runtime live-position list (flat index into currently-rendered spawns,
     // NOT indexed by group_id - must match by world coords later).
+    int posCount = 0;
     uint32_t rawSize = 0;
-    if (readU32(SPAWNER_BASE, SPAWNER_BASE_LEN, SIZE_FIELD, rawSize)) {
-        int posCount = (int)(rawSize / 0x40);
-        if (posCount > 0 && posCount < 4096) {
-            for (int i = 0; i < posCount; i++) {
-                float pos[3];
-                uint64_t seed = 0;
-                if (!readFloat3(SPAWNER_BASE, SPAWNER_BASE_LEN,
-                                POS_POSITION + i * POS_STRIDE, pos)) continue;
-                if (!readU64(SPAWNER_BASE, SPAWNER_BASE_LEN,
-                             POS_SEED + i * POS_STRIDE, seed)) continue;
-                if (seed == 0) continue;
-                if (pos[0] < 1.0f && pos[1] < 1.0f && pos[2] < 1.0f) continue;
-                livePositions_.push_back({pos[0], pos[1], pos[2]});
-            }
-        }
+    if (DmntMem::readAbsolute(base + SIZE_FIELD, reinterpret_cast<uint8_t*>(&rawSize),
+                              sizeof(rawSize))) {
+        posCount = (int)(rawSize / 0x40);
+        if (posCount <= 0 || posCount >= (int)PlaConfig::MAX_POSITIONS) posCount = 0;
+    }
+
+    // Both strides start at +0x70, so one span covers the position list and
+    // the group array.
+    size_t span = POS_POSITION + (uint64_t)maxGroups * GROUP_STRIDE;
+    span = std::max<size_t>(span, POS_SEED + (uint64_t)posCount * POS_STRIDE + 8);
+    auto& buf = scanBuf_;
+    size_t valid = readSpan(base, span, buf);
+
+    for (int i = 0; i < posCount; i++) {
+        float pos[3];
+        uint64_t seed = 0;
+        if (!parseAt(buf, valid, POS_POSITION + i * POS_STRIDE, pos)) break;
+        if (!parseAt(buf, valid, POS_SEED + i * POS_STRIDE, seed)) break;
+        if (seed == 0) continue;
+        if (pos[0] < 1.0f && pos[1] < 1.0f && pos[2] < 1.0f) continue;
+        positions.push_back({pos[0], pos[1], pos[2]});
     }
 
     // Group data (0x440 stride). Read raw seeds only - decoration is per-region.
     for (int gid = 0; gid < maxGroups; gid++) {
         uint64_t generatorSeed = 0;
-        if (!readU64(SPAWNER_BASE, SPAWNER_BASE_LEN,
-                     POS_POSITION + gid * GROUP_STRIDE + GROUP_GEN_SEED, generatorSeed))
+        if (!parseAt(buf, valid, POS_POSITION + gid * GROUP_STRIDE + GROUP_GEN_SEED,
+                     generatorSeed))
             break;
+        seeds[gid] = generatorSeed;
         if (generatorSeed == 0) continue;
 
-        PlaSpawner s{};
-        s.groupId = gid;
-        s.generatorSeed = generatorSeed;
-        s.groupSeed = generatorSeed - Xoroshiro128Plus::XOROSHIRO_CONST;
-        s.region = -1;
-        spawners_.push_back(s);
+        spawners.pushRaw(gid, generatorSeed - Xoroshiro128Plus::XOROSHIRO_CONST);
     }
+
+    if (outbreak && readOutbreakCount(outbreak->spawnCount))
+        outbreak->present = findOutbreakGroup(buf, valid, *outbreak);
     return true;
 }
 
-void PlaReader::decorate(PlaRegion region, int shinyRolls, int maxAdvance) {
-    size_t n;
-    const PlaMarkers::Marker* ms = PlaMarkers::getMarkers(region, n);
+const PlaEncounter::ShinyTable& PlaReader::shinyTable(uint64_t groupSeed, int maxAdvance) {
+    ShinyKey key{groupSeed, maxAdvance};
+    auto it = shinyMemo_.find(key);
+    if (it != shinyMemo_.end()) return it->second;
 
-    for (auto& s : spawners_) {
-        const PlaMarkers::Marker* m = nullptr;
-        for (size_t i = 0; i < n; i++) {
-            if (ms[i].groupId == s.groupId) { m = &ms[i]; break; }
-        }
+    if (shinyMemo_.size() >= SHINY_MEMO_MAX) shinyMemo_.clear();
+    return shinyMemo_.emplace(key, PlaEncounter::shinyTable(groupSeed, maxAdvance)).first->second;
+}
 
-        if (!m) {
-            s.region = -1;
-            s.markerX = s.markerY = s.markerZ = 0.0f;
-            s.guaranteedIvs = 0;
-            s.active = false;
-            s.livePosX = s.livePosY = s.livePosZ = 0.0f;
-            s.speciesName = nullptr;
-            s.alpha = false;
-            s.firstSpawn = PlaEncounter::firstFixed(s.groupSeed, shinyRolls, 0);
-            s.shinyAdvance = PlaEncounter::nextShiny(s.groupSeed, shinyRolls,
-                                                     0, true, maxAdvance);
-            continue;
+void PlaReader::primeShinyTables(int maxAdvance) {
+    if (maxAdvance < 0) return;
+    auto collect = [&] {
+        primeJobs_.clear();
+        for (uint64_t seed : spawners_.groupSeed) {
+            if (!shinyMemo_.count({seed, maxAdvance}))
+                primeJobs_.push_back({seed, PlaEncounter::MAX_SHINY_ROLLS});
         }
+    };
+    collect();
+    if (primeJobs_.empty()) return;
+    if (shinyMemo_.size() + primeJobs_.size() > SHINY_MEMO_MAX) {
+        shinyMemo_.clear();
+        collect();
+    }
 
-        s.region = (int)region;
-        s.markerX = m->x; s.markerY = m->y; s.markerZ = m->z;
-        s.guaranteedIvs = m->ivs;
+    primeTables_.resize(primeJobs_.size());
+    PlaShinySearch::Options opt;
+    opt.maxAdvance = (uint32_t)maxAdvance;
+    opt.threads = searchThreads_;
+    PlaShinySearch::runTables(primeJobs_.data(), primeJobs_.size(), opt, primeTables_.data());
+    for (size_t i = 0; i < primeJobs_.size(); i++)
+        shinyMemo_.emplace(ShinyKey{primeJobs_[i].groupSeed, maxAdvance}, primeTables_[i]);
+}
+
+void PlaReader::decorate(PlaRegion region, int shinyRolls, int maxAdvance) {
+    primeShinyTables(maxAdvance);
+    spawners_.shinyRolls = shinyRolls;
+    for (size_t i = 0; i < spawners_.size(); i++)
+        decorateRow(spawners_, i, region, PlaMarkers::markerFor(region, spawners_.groupId[i]),
+                    maxAdvance);
+}
 
-        // Active = any runtime live position within ~25 world units of this marker.
-        s.active = false;
-        s.livePosX = s.livePosY = s.livePosZ = 0.0f;
-        constexpr float R2 = 25.0f * 25.0f;
-        for (auto& lp : livePositions_) {
-            float dx = lp.x - m->x;
-            float dz = lp.z - m->z;
-            if (dx*dx + dz*dz <= R2) {
-                s.active = true;
-                s.livePosX = lp.x; s.livePosY = lp.y; s.livePosZ = lp.z;
-                break;
+void PlaReader::decorateAll(int shinyRolls, int maxAdvance, int nearThreshold) {
+    primeShinyTables(maxAdvance);
+    for (int r = 0; r < (int)PlaRegion::Count; r++) {
+        PlaRegion region = (PlaRegion)r;
+        RegionCache& cache = regions_[r];
+        PlaSpawnerTable& t = cache.spawners;
+        t.clear();
+        t.shinyRolls = shinyRolls;
+        cache.stats = {};
+
+        for (size_t raw = 0; raw < spawners_.size(); raw++) {
+            const PlaMarkers::Marker* m = PlaMarkers::markerFor(region, spawners_.groupId[raw]);
+            if (!m) continue;
+
+            size_t i = t.size();
+            t.pushRaw(spawners_.groupId[raw], spawners_.groupSeed[raw]);
+            decorateRow(t, i, region, m, maxAdvance);
+            if (t.speciesId[i] != 0) {  // story/placeholder spawners don't count
+                int adv = t.shinyAdvance[i];
+                cache.stats.total++;
+                if (t.shinyNow(i)) cache.stats.current++;
+                else if (adv > 0 && adv <= nearThreshold) cache.stats.near++;
             }
         }
+    }
+}
 
-        double slotRoll01 = 0.0;
-        s.firstSpawn   = PlaEncounter::firstFixed(s.groupSeed, shinyRolls,
-                                                  s.guaranteedIvs, &slotRoll01);
-        s.shinyAdvance = PlaEncounter::nextShiny(s.groupSeed, shinyRolls,
-                                                 s.guaranteedIvs, true, maxAdvance);
-
-        s.speciesName = nullptr;
-        s.speciesId = 0;
-        s.form = 0;
-        s.alpha = false;
-        if (m->slotCount > 0 && m->slotTotal > 0) {
-            const auto* entry = PlaMarkers::resolveSlot(*m, slotRoll01 * m->slotTotal);
-            if (entry) {
-                s.speciesName = entry->name;
-                s.speciesId   = entry->speciesId;
-                s.form        = entry->form;
-                s.alpha       = entry->alpha;
-            }
+void PlaReader::decorateRow(PlaSpawnerTable& t, size_t i, PlaRegion region,
+                            const PlaMarkers::Marker* m, int maxAdvance) {
+    uint64_t seed = t.groupSeed[i];
+    int adv = shinyTable(seed, maxAdvance).forRolls(t.shinyRolls);
+    t.shinyAdvance[i] = adv;
+    // Advance 0 is the init spawn, so the table already says whether it is shiny.
+    uint8_t flags = adv == 0 ? PlaSpawnerTable::SHINY_NOW : 0;
+    t.speciesId[i] = 0;
+    t.slot[i] = PlaSpawnerTable::NO_SLOT;
+
+    if (!m) {
+        t.region[i] = -1;
+        t.markerX[i] = t.markerZ[i] = 0.0f;
+        t.flags[i] = flags;
+        return;
+    }
+
+    t.region[i] = (int8_t)region;
+    t.markerX[i] = m->x;
+    t.markerZ[i] = m->z;
+    // Active = a runtime live position within ~25 world units of this marker.
+    if (liveGrid_.nearest(m->x, m->z, ACTIVE_RADIUS)) flags |= PlaSpawnerTable::ACTIVE;
+
+    if (const auto* entry = PlaMarkers::resolveSlotRaw(*m, PlaEncounter::firstSlotRaw(seed))) {
+        t.slot[i] = (uint16_t)(entry - PlaMarkers::SLOTS);
+        t.speciesId[i] = entry->speciesId;
+        if (entry->alpha) flags |= PlaSpawnerTable::ALPHA;
+    }
+    t.flags[i] = flags;
+}
+
+PlaSpawner PlaReader::detail(const PlaSpawnerTable& t, size_t i) const {
+    PlaSpawner s{};
+    s.groupId = t.groupId[i];
+    s.groupSeed = t.groupSeed[i];
+    s.generatorSeed = s.groupSeed + Xoroshiro128Plus::XOROSHIRO_CONST;
+    s.region = t.region[i];
+    s.shinyAdvance = t.shinyAdvance[i];
+    s.active = t.active(i);
+    s.markerX = t.markerX[i];
+    s.markerZ = t.markerZ[i];
+
+    const PlaMarkers::Marker* m =
+        s.region >= 0 ? PlaMarkers::markerFor((PlaRegion)s.region, s.groupId) : nullptr;
+    if (m) {
+        s.markerY = m->y;
+        s.guaranteedIvs = m->ivs;
+        // Report the nearest live position.
+        if (const PlaLivePos* lp = liveGrid_.nearest(m->x, m->z, ACTIVE_RADIUS)) {
+            s.livePosX = lp->x; s.livePosY = lp->y; s.livePosZ = lp->z;
         }
     }
+    s.firstSpawn = PlaEncounter::firstFixed(s.groupSeed, t.shinyRolls, s.guaranteedIvs);
+
+    if (t.slot[i] != PlaSpawnerTable::NO_SLOT) {
+        const PlaMarkers::SlotEntry& entry = PlaMarkers::SLOTS[t.slot[i]];
+        s.speciesName = entry.name;
+        s.speciesId   = entry.speciesId;
+        s.form        = entry.form;
+        s.alpha       = entry.alpha;
+    }
+    return s;
 }
 
 bool PlaReader::teleport(float x, float y, float z) {
@@ -156,34 +384,16 @@ bool PlaReader::teleport(float x, float y, float z) {
 
 PlaOutbreak PlaReader::readOutbreak() {
     PlaOutbreak ob{};
-    ob.present = false;
 
     using namespace PlaPointers;
-    for (int i = 0; i < 4; i++) {
-        uint8_t raw[1];
-        if (!readAt(OUTBREAK_BASE, OUTBREAK_BASE_LEN, 0x60 + i * 0x50, raw, 1)) continue;
-        if (raw[0] >= 10 && raw[0] <= 15) {
-            ob.spawnCount = raw[0];
-            ob.present = true;
-            break;
-        }
-    }
-    if (!ob.present) return ob;
+    DmntMem::Session session;
+    if (!readOutbreakCount(ob.spawnCount)) return ob;
 
-    for (int gid = 255; gid >= 0; gid--) {
-        uint64_t activeSeed = 0;
-        if (!readU64(SPAWNER_BASE, SPAWNER_BASE_LEN,
-                     POS_POSITION + gid * GROUP_STRIDE + GROUP_ACTIVE_SEED, activeSeed))
-            break;
-        if (activeSeed != 0) {
-            uint64_t genSeed = 0;
-            readU64(SPAWNER_BASE, SPAWNER_BASE_LEN,
-                    POS_POSITION + gid * GROUP_STRIDE + GROUP_GEN_SEED, genSeed);
-            ob.groupId = gid;
-            ob.groupSeed = genSeed - Xoroshiro128Plus::XOROSHIRO_CONST;
-            return ob;
-        }
-    }
-    ob.present = false;
+    uint64_t base = 0;
+    if (!resolveAt(SPAWNER_BASE, SPAWNER_BASE_LEN, 0, base)) return ob;
+    auto& buf = scanBuf_;
+    size_t valid = readSpan(base, POS_POSITION + PlaConfig::MAX_GROUPS * GROUP_STRIDE, buf);
+    ob.present = findOutbreakGroup(buf, valid, ob);
+    trackedOutbreak_ = ob;
     return ob;
 }
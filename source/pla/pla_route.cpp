@@ -0,0 +1,363 @@
+#include "pla/pla_route.h"
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+using Stop = PlaRoutePlanner::Stop;
+
+// Moves must gain at least this much (world units) so float noise can't cycle.
+constexpr float EPS = 1e-3f;
+
+// Bucket grid over a node set for nearest / k-nearest queries, with removal
+// so nearest-neighbour construction can drop visited stops.
+class StopGrid {
+public:
+    void build(const std::vector<Stop>& nodes, int first) {
+        nodes_ = &nodes;
+        float maxX = 0, maxZ = 0;
+        minX_ = minZ_ = 0;
+        for (int i = first; i < (int)nodes.size(); i++) {
+            const Stop& s = nodes[i];
+            if (i == first) { minX_ = maxX = s.x; minZ_ = maxZ = s.z; continue; }
+            minX_ = std::min(minX_, s.x); maxX = std::max(maxX, s.x);
+            minZ_ = std::min(minZ_, s.z); maxZ = std::max(maxZ, s.z);
+        }
+        // About two stops per cell.
+        int count = std::max(1, (int)nodes.size() - first);
+        float area = std::max(1.0f, (maxX - minX_) * (maxZ - minZ_));
+        float extent = std::max(maxX - minX_, maxZ - minZ_);
+        cell_ = std::max({1.0f, std::sqrt(area * 2.0f / count), extent / MAX_CELLS_PER_AXIS});
+        cols_ = (int)((maxX - minX_) / cell_) + 1;
+        rows_ = (int)((maxZ - minZ_) / cell_) + 1;
+        cells_.assign((size_t)cols_ * rows_, {});
+        for (int i = first; i < (int)nodes.size(); i++)
+            cells_[cellOf(nodes[i].x, nodes[i].z)].push_back(i);
+    }
+
+    void remove(int node) {
+        auto& c = cells_[cellOf((*nodes_)[node].x, (*nodes_)[node].z)];
+        auto it = std::find(c.begin(), c.end(), node);
+        if (it != c.end()) { *it = c.back(); c.pop_back(); }
+    }
+
+    // Nearest remaining node to (x, z), or -1.
+    int nearest(float x, float z) const {
+        int best = -1;
+        float bestD = 0;
+        forRings(x, z, [&](int node, float d) {
+            if (best < 0 || d < bestD) { best = node; bestD = d; }
+        }, [&](float ringMin) { return best >= 0 && bestD <= ringMin; });
+        return best;
+    }
+
+    // Up to k nearest nodes to `self` (excluding it), nearest first; -1 pads.
+    void kNearest(int self, int k, int* out) const {
+        float d[16];
+        int n = 0;
+        const Stop& s = (*nodes_)[self];
+        forRings(s.x, s.z, [&](int node, float dn) {
+            if (node == self) return;
+            if (n == k && dn >= d[k - 1]) return;
+            int i = (n < k) ? n++ : k - 1;
+            while (i > 0 && d[i - 1] > dn) { d[i] = d[i - 1]; out[i] = out[i - 1]; i--; }
+            d[i] = dn;
+            out[i] = node;
+        }, [&](float ringMin) { return n == k && d[k - 1] <= ringMin; });
+        for (int i = n; i < k; i++) out[i] = -1;
+    }
+
+private:
+    static constexpr int MAX_CELLS_PER_AXIS = 64;
+
+    const std::vector<Stop>* nodes_ = nullptr;
+    float minX_ = 0, minZ_ = 0, cell_ = 1;
+    int cols_ = 0, rows_ = 0;
+    std::vector<std::vector<int>> cells_;
+
+    int clampCol(int c) const { return std::clamp(c, 0, cols_ - 1); }
+    int clampRow(int r) const { return std::clamp(r, 0, rows_ - 1); }
+    size_t cellOf(float x, float z) const {
+        return (size_t)clampRow((int)((z - minZ_) / cell_)) * cols_ +
+               clampCol((int)((x - minX_) / cell_));
+    }
+
+    // Visit nodes ring by ring around (x, z) until done(minimum distance of
+    // anything in the next ring) says the answer can't improve.
+    template <class Visit, class Done>
+    void forRings(float x, float z, Visit visit, Done done) const {
+        int cx = clampCol((int)std::floor((x - minX_) / cell_));
+        int cz = clampRow((int)std::floor((z - minZ_) / cell_));
+        int maxRing = std::max(cols_, rows_);
+        for (int r = 0; r <= maxRing; r++) {
+            for (int gz = cz - r; gz <= cz + r; gz++) {
+                if (gz < 0 || gz >= rows_) continue;
+                bool edgeRow = (gz == cz - r || gz == cz + r);
+                for (int gx = cx - r; gx <= cx + r; gx += edgeRow ? 1 : 2 * r) {
+                    if (gx >= 0 && gx < cols_) {
+                        for (int node : cells_[(size_t)gz * cols_ + gx]) {
+                            const Stop& s = (*nodes_)[node];
+                            visit(node, std::hypot(s.x - x, s.z - z));
+                        }
+                    }
+                    if (r == 0) break;
+                }
+            }
+            if (done(r * cell_)) return;
+        }
+    }
+};
+
+} // anonymous
+
+float PlaRoutePlanner::dist(int a, int b) const {
+    return std::hypot(nodes_[a].x - nodes_[b].x, nodes_[a].z - nodes_[b].z);
+}
+
+float PlaRoutePlanner::edge(int posA, int posB) const {
+    if (posB >= (int)route_.size()) return 0.0f;
+    return dist(route_[posA], route_[posB]);
+}
+
+void PlaRoutePlanner::clear() {
+    nodes_.clear();
+    route_.clear();
+    pos_.clear();
+    neighbours_.clear();
+    active_.clear();
+}
+
+void PlaRoutePlanner::plan(const std::vector<Stop>& stops, float startX, float startZ) {
+    clear();
+    nodes_.push_back({-1, startX, startZ, 0});
+    nodes_.insert(nodes_.end(), stops.begin(), stops.end());
+    nearestNeighbourTour();
+    buildNeighbours();
+    active_.assign(nodes_.size(), 0);
+    for (int i = 1; i < (int)nodes_.size(); i++) activate(i);
+    improve();
+}
+
+void PlaRoutePlanner::update(const std::vector<Stop>& stops) {
+    if (nodes_.empty()) return;
+
+    std::unordered_map<int, const Stop*> byId;
+    for (const auto& s : stops) byId[s.id] = &s;
+
+    // Keep surviving stops in their current order; remember which kept stops
+    // lost a route neighbour so only they are looked at again.
+    std::vector<Stop> kept{nodes_[0]};
+    std::vector<int> touched;
+    std::unordered_set<int> keptIds;
+    bool lastRemoved = false;
+    for (size_t p = 1; p < route_.size(); p++) {
+        const Stop& old = nodes_[route_[p]];
+        auto it = byId.find(old.id);
+        if (it == byId.end()) {
+            if (kept.size() > 1) touched.push_back((int)kept.size() - 1);
+            lastRemoved = true;
+            continue;
+        }
+        if (lastRemoved) touched.push_back((int)kept.size());
+        lastRemoved = false;
+        kept.push_back(*it->second);
+        keptIds.insert(old.id);
+    }
+
+    std::vector<const Stop*> added;
+    for (const auto& s : stops)
+        if (!keptIds.count(s.id)) added.push_back(&s);
+    // Mostly new: a fresh construction beats many cheapest insertions.
+    if (added.size() * 2 > stops.size()) {
+        plan(stops, nodes_[0].x, nodes_[0].z);
+        return;
+    }
+
+    nodes_ = std::move(kept);
+    route_.resize(nodes_.size());
+    for (int i = 0; i < (int)nodes_.size(); i++) route_[i] = i;
+    reindex();
+    for (const Stop* s : added) {
+        nodes_.push_back(*s);
+        insertCheapest((int)nodes_.size() - 1);
+        touched.push_back((int)nodes_.size() - 1);
+    }
+
+    buildNeighbours();
+    active_.assign(nodes_.size(), 0);
+    queue_.clear();
+    for (int n : touched) {
+        activate(n);
+        int p = pos_[n];
+        if (p > 1) activate(route_[p - 1]);
+        if (p + 1 < (int)route_.size()) activate(route_[p + 1]);
+    }
+    improve();
+}
+
+std::vector<PlaRoutePlanner::Stop> PlaRoutePlanner::route() const {
+    std::vector<Stop> out;
+    for (size_t p = 1; p < route_.size(); p++) out.push_back(nodes_[route_[p]]);
+    return out;
+}
+
+float PlaRoutePlanner::travel() const {
+    float t = 0.0f;
+    for (size_t p = 1; p < route_.size(); p++) t += dist(route_[p - 1], route_[p]);
+    return t;
+}
+
+float PlaRoutePlanner::cost() const {
+    float c = travel();
+    for (size_t i = 1; i < nodes_.size(); i++) c += advanceCost * nodes_[i].advances;
+    return c;
+}
+
+void PlaRoutePlanner::nearestNeighbourTour() {
+    StopGrid grid;
+    grid.build(nodes_, 1);
+    route_.assign(1, 0);
+    int cur = 0;
+    for (size_t i = 1; i < nodes_.size(); i++) {
+        int next = grid.nearest(nodes_[cur].x, nodes_[cur].z);
+        grid.remove(next);
+        route_.push_back(next);
+        cur = next;
+    }
+    reindex();
+}
+
+void PlaRoutePlanner::buildNeighbours() {
+    StopGrid grid;
+    grid.build(nodes_, 0);
+    neighbours_.assign(nodes_.size() * NEIGHBOURS, -1);
+    for (int i = 0; i < (int)nodes_.size(); i++)
+        grid.kNearest(i, NEIGHBOURS, &neighbours_[(size_t)i * NEIGHBOURS]);
+}
+
+void PlaRoutePlanner::insertCheapest(int node) {
+    int bestPos = (int)route_.size();          // append
+    float bestAdd = dist(route_.back(), node);
+    for (int p = 0; p + 1 < (int)route_.size(); p++) {
+        float add = dist(route_[p], node) + dist(node, route_[p + 1]) -
+                    dist(route_[p], route_[p + 1]);
+        if (add < bestAdd) { bestAdd = add; bestPos = p + 1; }
+    }
+    route_.insert(route_.begin() + bestPos, node);
+    reindex();
+}
+
+void PlaRoutePlanner::activate(int node) {
+    if (node <= 0 || active_[node]) return;
+    active_[node] = 1;
+    queue_.push_back(node);
+}
+
+void PlaRoutePlanner::reindex() {
+    pos_.assign(nodes_.size(), -1);
+    for (int p = 0; p < (int)route_.size(); p++) pos_[route_[p]] = p;
+}
+
+void PlaRoutePlanner::improve() {
+    while (!queue_.empty()) {
+        int a = queue_.back();
+        queue_.pop_back();
+        active_[a] = 0;
+        if (tryTwoOpt(a) || tryOrOpt(a)) activate(a);
+    }
+}
+
+// Reversing positions [i+1, j] replaces edges (i, i+1) and (j, j+1) with
+// (i, j) and (i+1, j+1); on an open path the second pair is absent when j is
+// the last position. Try both ways of making a-c one of the new edges.
+bool PlaRoutePlanner::tryTwoOpt(int a) {
+    const int* nb = &neighbours_[(size_t)a * NEIGHBOURS];
+    for (int k = 0; k < NEIGHBOURS && nb[k] >= 0; k++) {
+        int c = nb[k];
+        int lo = std::min(pos_[a], pos_[c]), hi = std::max(pos_[a], pos_[c]);
+
+        // a-c as (i, j).
+        int i = lo, j = hi;
+        if (j > i + 1) {
+            float delta = dist(route_[i], route_[j]) + edge(i + 1, j + 1) -
+                          edge(i, i + 1) - edge(j, j + 1);
+            if (delta < -EPS) {
+                std::reverse(route_.begin() + i + 1, route_.begin() + j + 1);
+                reindex();
+                for (int p : {i, i + 1, j, j + 1})
+                    if (p < (int)route_.size()) activate(route_[p]);
+                return true;
+            }
+        }
+        // a-c as (i+1, j+1).
+        i = lo - 1; j = hi - 1;
+        if (i >= 0 && j > i + 1) {
+            float delta = dist(route_[i], route_[j]) + dist(route_[i + 1], route_[j + 1]) -
+                          edge(i, i + 1) - edge(j, j + 1);
+            if (delta < -EPS) {
+                std::reverse(route_.begin() + i + 1, route_.begin() + j + 1);
+                reindex();
+                for (int p : {i, i + 1, j, j + 1}) activate(route_[p]);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Move the 1-3 stops starting at a next to one of a's neighbours, in either
+// orientation.
+bool PlaRoutePlanner::tryOrOpt(int a) {
+    const int n = (int)route_.size();
+    const int s = pos_[a];
+    const int* nb = &neighbours_[(size_t)a * NEIGHBOURS];
+    for (int len = 1; len <= 3 && s + len - 1 < n; len++) {
+        int e = s + len - 1;
+        int prev = route_[s - 1];
+        int next = (e + 1 < n) ? route_[e + 1] : -1;
+        float removeGain = dist(prev, route_[s]);
+        if (next >= 0) removeGain += dist(route_[e], next) - dist(prev, next);
+
+        for (int k = 0; k < NEIGHBOURS && nb[k] >= 0; k++) {
+            int q = pos_[nb[k]];
+            if (q >= s && q <= e) continue;
+            // Gaps next to the neighbour, as (u, v) on the path without the
+            // segment; v = -1 appends at the end.
+            for (int side = 0; side < 2; side++) {
+                int u, v;
+                if (side == 0) {
+                    u = route_[q];
+                    v = (q + 1 == s) ? next : (q + 1 < n ? route_[q + 1] : -1);
+                } else {
+                    if (q == 0) continue;
+                    u = (q - 1 == e) ? prev : route_[q - 1];
+                    v = route_[q];
+                }
+                if (u == prev) continue;    // that's where the segment already is
+
+                float uv = (v >= 0) ? dist(u, v) : 0.0f;
+                float fwd = dist(u, route_[s]) + (v >= 0 ? dist(route_[e], v) : 0.0f) - uv;
+                float rev = dist(u, route_[e]) + (v >= 0 ? dist(route_[s], v) : 0.0f) - uv;
+                float add = std::min(fwd, rev);
+                if (removeGain - add <= EPS) continue;
+
+                std::vector<int> seg(route_.begin() + s, route_.begin() + e + 1);
+                if (rev < fwd) std::reverse(seg.begin(), seg.end());
+                route_.erase(route_.begin() + s, route_.begin() + e + 1);
+                int at = (int)(std::find(route_.begin(), route_.end(), u) - route_.begin()) + 1;
+                route_.insert(route_.begin() + at, seg.begin(), seg.end());
+                reindex();
+                activate(prev);
+                if (next >= 0) activate(next);
+                activate(u);
+                if (v >= 0) activate(v);
+                activate(seg.front());
+                activate(seg.back());
+                return true;
+            }
+        }
+    }
+    return false;
+}
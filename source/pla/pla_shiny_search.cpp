@@ -0,0 +1,183 @@
+#include "pla/pla_shiny_search.h"
+#include "thread_util.h"
+#include <algorithm>
+#include <atomic>
+
+namespace PlaShinySearch {
+namespace {
+
+constexpr uint32_t REJECT = 0xFFFFFFFFu;  // nextInt(0xFFFFFFFF) rerolls this value
+constexpr int LANES = 4;                  // seeds walked in lockstep per thread
+
+// Group RNG advance (mirrors nextShiny): returns the spawn's fixed seed and
+// moves `group` to the reseeded state for the next advance.
+inline uint64_t advanceGroup(uint64_t& group) {
+    Xoroshiro128Plus main(group);
+    uint64_t gen = main.next();
+    main.next();                        // spawner 1's seed, unused
+    group = main.next();                // reseed: (r, CONST)
+
+    Xoroshiro128Plus spawner(gen);
+    spawner.next();                     // slot roll, unused
+    return spawner.next();
+}
+
+// Shiny check on a fixed seed: the EC/SIDTID/PID prefix of generateFromSeed
+// without its rejection loops. Returns -1 when a 32-bit draw hit the
+// rejection value (generateFromSeed would have rerolled it); the caller then
+// falls back to the exact path.
+inline int fastShiny(uint64_t fixedSeed, int rolls) {
+    Xoroshiro128Plus rng(fixedSeed);
+    uint32_t ec = (uint32_t)rng.next();
+    uint32_t sidtid = (uint32_t)rng.next();
+    if (ec == REJECT || sidtid == REJECT) return -1;
+    uint32_t tsv = (sidtid >> 16) ^ (sidtid & 0xFFFF);
+    for (int i = 0; i < rolls; i++) {
+        uint32_t pid = (uint32_t)rng.next();
+        if (pid == REJECT) return -1;
+        if (((pid >> 16) ^ (pid & 0xFFFF) ^ tsv) < 0x10) return 1;
+    }
+    return 0;
+}
+
+// firstShinyRoll without the rejection loops, same contract as fastShiny:
+// the roll index, -1 for none, or -2 to fall back to the exact path.
+inline int fastShinyRoll(uint64_t fixedSeed, int maxRolls) {
+    Xoroshiro128Plus rng(fixedSeed);
+    uint32_t ec = (uint32_t)rng.next();
+    uint32_t sidtid = (uint32_t)rng.next();
+    if (ec == REJECT || sidtid == REJECT) return -2;
+    uint32_t tsv = (sidtid >> 16) ^ (sidtid & 0xFFFF);
+    for (int i = 0; i < maxRolls; i++) {
+        uint32_t pid = (uint32_t)rng.next();
+        if (pid == REJECT) return -2;
+        if (((pid >> 16) ^ (pid & 0xFFFF) ^ tsv) < 0x10) return i;
+    }
+    return -1;
+}
+
+// A lane runs one job at a time. probe() is the branch-light per-advance
+// check (0 = nothing to do); hit() handles a non-zero probe and returns true
+// when the job is done. Results are written as they are found, so a
+// cancelled job keeps what it had.
+
+// Search walk: stops at firstK hits.
+struct SearchLane {
+    Hits* out;
+    int   rolls;
+    int   firstK;
+
+    void start(const Job& job, const Options& opt, Hits& h) {
+        out = &h;
+        rolls = job.shinyRolls;
+        firstK = opt.firstK;
+    }
+    int probe(uint64_t fixedSeed) const { return fastShiny(fixedSeed, rolls); }
+    bool hit(uint32_t adv, uint64_t fixedSeed, int probed) {
+        if (probed < 0 && !PlaEncounter::generateFromSeed(fixedSeed, rolls, 0).shiny)
+            return false;
+        out->advance[out->count++] = adv;
+        return out->count >= firstK;
+    }
+};
+
+// Table walk: only draws as many PID rolls as the largest unresolved count.
+struct TableLane {
+    PlaEncounter::ShinyTable* out;
+    int open;                                 // counts 1..open are unresolved
+
+    void start(const Job&, const Options&, PlaEncounter::ShinyTable& t) {
+        out = &t;
+        open = PlaEncounter::MAX_SHINY_ROLLS;
+    }
+    // fastShinyRoll shifted by one: 0 = none, -1 = exact path, k + 1 = roll k.
+    int probe(uint64_t fixedSeed) const { return fastShinyRoll(fixedSeed, open) + 1; }
+    bool hit(uint32_t adv, uint64_t fixedSeed, int probed) {
+        int idx = probed > 0 ? probed - 1 : PlaEncounter::firstShinyRoll(fixedSeed, open);
+        if (idx < 0) return false;
+        for (int r = idx + 1; r <= open; r++) out->advance[r - 1] = (int)adv;
+        open = idx;
+        return open == 0;
+    }
+};
+
+// One worker: walks LANES jobs in lockstep, one advance per lane per step.
+// The group RNG chain is serial within a seed, so independent seeds side by
+// side are what keep the core's pipeline full; the advance and probe passes
+// are kept free of per-lane bookkeeping for that reason. A lane whose job
+// ends (done, maxAdvance) takes the next job from `next`; once none are
+// left it idles, still walking its old seed, until the others finish.
+template <class Lane, class Result>
+void walkLanes(const Job* jobs, size_t count, std::atomic<size_t>& next,
+               const Options& opt, Result* out) {
+    Lane lane[LANES];
+    uint64_t group[LANES] = {};
+    uint32_t adv[LANES] = {};
+    bool active[LANES] = {};
+    int live = 0;
+
+    for (int l = 0; l < LANES; l++) {
+        size_t j = next.fetch_add(1, std::memory_order_relaxed);
+        if (j >= count) break;
+        lane[l].start(jobs[j], opt, out[j]);
+        group[l] = jobs[j].groupSeed;
+        active[l] = true;
+        live++;
+    }
+
+    for (uint32_t n = 0; live > 0; n++) {
+        if (ThreadUtil::cancelPoll(opt.cancel, n)) return;
+        for (int l = 0; l < LANES; l++) {
+            uint64_t fixedSeed = advanceGroup(group[l]);
+            int probed = lane[l].probe(fixedSeed);
+            bool done = adv[l]++ == opt.maxAdvance;
+            if (__builtin_expect(probed != 0, 0))
+                done |= active[l] && lane[l].hit(adv[l] - 1, fixedSeed, probed);
+            if (__builtin_expect(!done || !active[l], 1)) continue;
+            size_t j = next.fetch_add(1, std::memory_order_relaxed);
+            if (j < count) {
+                lane[l].start(jobs[j], opt, out[j]);
+                group[l] = jobs[j].groupSeed;
+                adv[l] = 0;
+            } else {
+                active[l] = false;
+                live--;
+            }
+        }
+    }
+}
+
+template <class Lane, class Result>
+void runLanes(const Job* jobs, size_t count, const Options& opt, Result* out) {
+    std::atomic<size_t> next{0};
+    size_t workers = std::max<size_t>(1, std::min<size_t>(std::max(opt.threads, 1),
+                                                          (count + LANES - 1) / LANES));
+    ThreadUtil::parallelFor(workers, (int)workers, [&](size_t) {
+        walkLanes<Lane>(jobs, count, next, opt, out);
+    });
+}
+
+Options normalised(const Options& options) {
+    Options opt = options;
+    opt.firstK = std::clamp(opt.firstK, 1, MAX_HITS);
+    opt.maxAdvance = std::min(opt.maxAdvance, UINT32_MAX - 1);  // keep adv++ from wrapping
+    return opt;
+}
+
+} // anonymous
+
+void run(const Job* jobs, size_t count, const Options& options, Hits* out) {
+    Options opt = normalised(options);
+    for (size_t j = 0; j < count; j++) out[j].count = 0;
+    runLanes<SearchLane>(jobs, count, opt, out);
+}
+
+void runTables(const Job* jobs, size_t count, const Options& options,
+               PlaEncounter::ShinyTable* out) {
+    Options opt = normalised(options);
+    for (size_t j = 0; j < count; j++)
+        for (int i = 0; i < PlaEncounter::MAX_SHINY_ROLLS; i++) out[j].advance[i] = -1;
+    runLanes<TableLane>(jobs, count, opt, out);
+}
+
+} // namespace PlaShinySearch
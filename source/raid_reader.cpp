@@ -1,27 +1,100 @@
 #include "raid_reader.h"
+#include <algorithm>
+#include <chrono>
 #include <cstdio>
+#include <cstring>
 
-#ifdef __SWITCH__
 #include "dmnt_mem.h"
-#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+uint32_t microsSince(Clock::time_point start) {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        Clock::now() - start).count();
+}
+
+const char* mapFilePrefix(TeraRaidMapParent map) {
+    switch (map) {
+        case TeraRaidMapParent::Kitakami:  return "kitakami";
+        case TeraRaidMapParent::Blueberry: return "blueberry";
+        default:                           return "paldea";
+    }
+}
+
+} // anonymous
 
 bool RaidReader::loadResources(const std::string& dir) {
-    if (!personal_.load(dir + "personal_sv"))
-        return false;
+    dataDir_ = dir;
+
+    auto start = Clock::now();
+    bool ok = personal_.load(dir + "personal_sv");
+    recordTiming("personal_sv", microsSince(start), ok);
+    return ok;
+}
+
+void RaidReader::ensureMapLoaded(TeraRaidMapParent map) {
+    encounterTable(map, false);
+    encounterTable(map, true);
+    ensureLocations(map);
+    ensureRewards();
+}
+
+const EncounterTable& RaidReader::encounterTable(TeraRaidMapParent map, bool black) {
+    int m = (int)map, b = black ? 1 : 0;
+    std::call_once(tableOnce_[m][b], [&] {
+        std::string name = std::string("encounter_gem_") + mapFilePrefix(map)
+                         + (black ? "_black.pkl" : "_standard.pkl");
+        auto start = Clock::now();
+        bool ok = tables_[m][b].loadFromFile(dataDir_ + name, personal_);
+        tables_[m][b].map = map;
+        recordTiming(name, microsSince(start), ok);
+    });
+    return tables_[m][b];
+}
+
+void RaidReader::ensureLocations(TeraRaidMapParent map) {
+    std::call_once(locationOnce_[(int)map], [&] {
+        std::string name = std::string(mapFilePrefix(map)) + "_locations.json";
+        auto start = Clock::now();
+        bool ok = locations_.loadMap(map, dataDir_ + name);
+        recordTiming(name, microsSince(start), ok);
+    });
+}
+
+void RaidReader::ensureRewards() {
+    std::call_once(rewardOnce_, [&] {
+        auto start = Clock::now();
+        bool ok = rewardCalc_.loadTables(dataDir_ + "reward_fixed.bin",
+                                         dataDir_ + "reward_lottery.bin");
+        recordTiming("reward_fixed.bin + reward_lottery.bin", microsSince(start), ok);
+    });
+}
 
-    locations_.load(dir + "paldea_locations.json",
-                    dir + "kitakami_locations.json",
-                    dir + "blueberry_locations.json");
+void RaidReader::recordTiming(const std::string& name, uint32_t micros, bool ok) {
+    std::lock_guard<std::mutex> lock(timingsMutex_);
+    timings_.push_back({name, micros, ok});
+}
 
-    paldeaStandard_.loadFromFile(dir + "encounter_gem_paldea_standard.pkl", personal_);
-    paldeaBlack_.loadFromFile(dir + "encounter_gem_paldea_black.pkl", personal_);
-    kitakamiStandard_.loadFromFile(dir + "encounter_gem_kitakami_standard.pkl", personal_);
-    kitakamiBlack_.loadFromFile(dir + "encounter_gem_kitakami_black.pkl", personal_);
-    blueberryStandard_.loadFromFile(dir + "encounter_gem_blueberry_standard.pkl", personal_);
-    blueberryBlack_.loadFromFile(dir + "encounter_gem_blueberry_black.pkl", personal_);
+std::vector<ResourceLoadTime> RaidReader::loadTimings() const {
+    std::lock_guard<std::mutex> lock(timingsMutex_);
+    return timings_;
+}
 
-    rewardCalc_.loadTables(dir + "reward_fixed.bin", dir + "reward_lottery.bin");
+bool RaidReader::writeLoadReport(const std::string& path) const {
+    auto timings = loadTimings();
+    FILE* f = fopen(path.c_str(), "w");
+    if (!f) return false;
 
+    uint64_t total = 0;
+    for (auto& t : timings) {
+        fprintf(f, "%-40s %8.2f ms%s\n", t.name.c_str(), t.micros / 1000.0,
+                t.ok ? "" : "  (FAILED)");
+        total += t.micros;
+    }
+    fprintf(f, "%-40s %8.2f ms\n", "total", total / 1000.0);
+    fclose(f);
     return true;
 }
 
@@ -60,21 +133,33 @@ bool RaidReader::readSave(const std::string& savePath, GameVersion version) {
     return !raids_.empty();
 }
 
-bool RaidReader::readLive([[maybe_unused]] GameVersion version) {
-#ifdef __SWITCH__
+bool RaidReader::resolveLiveBlocks() {
+    // Both raid blocks share the [[main+47350D8]+1C0]+88 prefix.
+    DmntMem::Session session;
+    return DmntMem::resolveChain(DmntPointers::KTeraRaidPaldea, DmntPointers::KTeraRaidPaldeaLen,
+                                 paldeaAddr_) &&
+           DmntMem::resolveChain(DmntPointers::KTeraRaidDLC, DmntPointers::KTeraRaidDLCLen,
+                                 dlcAddr_);
+}
+
+bool RaidReader::readLiveBlocks(std::vector<uint8_t>& paldea, std::vector<uint8_t>& dlc) {
+    paldea.resize(DmntPointers::KTeraRaidPaldeaSize);
+    dlc.resize(DmntPointers::KTeraRaidDLCSize);
+    return DmntMem::readAbsolute(paldeaAddr_, paldea.data(), paldea.size()) &&
+           DmntMem::readAbsolute(dlcAddr_, dlc.data(), dlc.size());
+}
+
+bool RaidReader::readLive(GameVersion version) {
     raids_.clear();
     raids_.reserve(200);
+    paldeaRaw_.clear();
+    dlcRaw_.clear();
+    pollCount_ = 0;
 
-    // Read Paldea raid block from game memory
-    std::vector<uint8_t> paldeaBuf(DmntPointers::KTeraRaidPaldeaSize);
-    if (!DmntMem::readBlock(DmntPointers::KTeraRaidPaldea, DmntPointers::KTeraRaidPaldeaLen,
-                            paldeaBuf.data(), paldeaBuf.size()))
-        return false;
+    DmntMem::Session session;
 
-    // Read DLC raid block (Kitakami + Blueberry)
-    std::vector<uint8_t> dlcBuf(DmntPointers::KTeraRaidDLCSize);
-    if (!DmntMem::readBlock(DmntPointers::KTeraRaidDLC, DmntPointers::KTeraRaidDLCLen,
-                            dlcBuf.data(), dlcBuf.size()))
+    // Read the Paldea and DLC (Kitakami + Blueberry) raid blocks
+    if (!resolveLiveBlocks() || !readLiveBlocks(paldeaRaw_, dlcRaw_))
         return false;
 
     // Read MyStatus block for trainer ID
@@ -92,8 +177,8 @@ bool RaidReader::readLive([[maybe_unused]] GameVersion version) {
 
     // Parse raid slots from raw bytes
     std::vector<TeraRaidDetail> paldea, kitakami, blueberry;
-    RaidBlockData::parsePaldea(paldeaBuf.data(), paldeaBuf.size(), paldea);
-    RaidBlockData::parseDLC(dlcBuf.data(), dlcBuf.size(), kitakami, blueberry);
+    RaidBlockData::parsePaldea(paldeaRaw_.data(), paldeaRaw_.size(), paldea);
+    RaidBlockData::parseDLC(dlcRaw_.data(), dlcRaw_.size(), kitakami, blueberry);
 
     // Process each region (shared with save file path)
     processSlots(paldea, TeraRaidMapParent::Paldea, version, 0);
@@ -101,70 +186,123 @@ bool RaidReader::readLive([[maybe_unused]] GameVersion version) {
     processSlots(blueberry, TeraRaidMapParent::Blueberry, version, 172);
 
     return !raids_.empty();
-#else
-    return false;
-#endif
+}
+
+bool RaidReader::pollLive(GameVersion version, std::vector<RaidPatch>& out) {
+    if (paldeaRaw_.empty() || dlcRaw_.empty()) return false;
+
+    // Steady state: two reads and two memcmps. The chains are walked again
+    // periodically, and right away if a cached address stopped being readable.
+    if (++pollCount_ % RESOLVE_EVERY == 0 && !resolveLiveBlocks())
+        return false;
+    if (!readLiveBlocks(pollPaldea_, pollDlc_)) {
+        if (!resolveLiveBlocks() || !readLiveBlocks(pollPaldea_, pollDlc_))
+            return false;
+    }
+
+    bool paldeaSame = std::memcmp(pollPaldea_.data(), paldeaRaw_.data(), paldeaRaw_.size()) == 0;
+    bool dlcSame = std::memcmp(pollDlc_.data(), dlcRaw_.data(), dlcRaw_.size()) == 0;
+    if (paldeaSame && dlcSame) return false;
+
+    // Slot layout matches RaidBlockData::parsePaldea/parseDLC.
+    constexpr int SLOT = TeraRaidDetail::SIZE;
+    constexpr int DLC_REGION = 0xC80;
+    size_t before = out.size();
+    if (!paldeaSame)
+        diffSlots(paldeaRaw_.data() + 0x10, pollPaldea_.data() + 0x10, 72,
+                  TeraRaidMapParent::Paldea, version, 0, out);
+    if (!dlcSame) {
+        diffSlots(dlcRaw_.data(), pollDlc_.data(), DLC_REGION / SLOT,
+                  TeraRaidMapParent::Kitakami, version, 72, out);
+        diffSlots(dlcRaw_.data() + DLC_REGION, pollDlc_.data() + DLC_REGION, 80,
+                  TeraRaidMapParent::Blueberry, version, 172, out);
+    }
+
+    paldeaRaw_.swap(pollPaldea_);
+    dlcRaw_.swap(pollDlc_);
+    return out.size() > before;
+}
+
+void RaidReader::diffSlots(const uint8_t* before, const uint8_t* after, int count,
+                           TeraRaidMapParent map, GameVersion version, int startIndex,
+                           std::vector<RaidPatch>& out) {
+    constexpr int SLOT = TeraRaidDetail::SIZE;
+    for (int i = 0; i < count; i++) {
+        if (std::memcmp(before + i * SLOT, after + i * SLOT, SLOT) == 0)
+            continue;
+        RaidPatch patch;
+        patch.slotIndex = startIndex + i;
+        patch.present = processSlot(TeraRaidDetail::readFrom(after + i * SLOT),
+                                    map, version, patch.slotIndex, patch.info);
+        out.push_back(std::move(patch));
+    }
+}
+
+void RaidReader::applyPatches(const std::vector<RaidPatch>& patches) {
+    for (const auto& patch : patches) {
+        auto it = std::lower_bound(raids_.begin(), raids_.end(), patch.slotIndex,
+            [](const RaidInfo& r, int slot) { return r.slotIndex < slot; });
+        bool found = it != raids_.end() && it->slotIndex == patch.slotIndex;
+        if (!patch.present) {
+            if (found) raids_.erase(it);
+        } else if (found) {
+            *it = patch.info;
+        } else {
+            raids_.insert(it, patch.info);
+        }
+    }
 }
 
 void RaidReader::processSlots(const std::vector<TeraRaidDetail>& slots,
                               TeraRaidMapParent map, GameVersion version,
                               int startIndex) {
     for (int i = 0; i < (int)slots.size(); i++) {
-        auto& slot = slots[i];
+        RaidInfo info;
+        if (processSlot(slots[i], map, version, startIndex + i, info))
+            raids_.push_back(std::move(info));
+    }
+}
 
-        if (!slot.isEnabled || slot.areaID == 0)
-            continue;
+bool RaidReader::processSlot(const TeraRaidDetail& slot, TeraRaidMapParent map,
+                             GameVersion version, int slotIndex, RaidInfo& info) {
+    if (!slot.isEnabled || slot.areaID == 0)
+        return false;
 
-        // Skip event/mighty raids (not supported in v1)
-        RaidContent rc = slot.raidContent();
-        if (rc == RaidContent::Event || rc == RaidContent::Event_Mighty)
-            continue;
+    // Skip event/mighty raids (not supported in v1)
+    RaidContent rc = slot.raidContent();
+    if (rc == RaidContent::Event || rc == RaidContent::Event_Mighty)
+        return false;
 
-        // Select encounter table
-        const std::vector<EncounterTeraTF9>* table = nullptr;
-        switch (map) {
-            case TeraRaidMapParent::Paldea:
-                table = (rc == RaidContent::Black)
-                    ? &paldeaBlack_.entries
-                    : &paldeaStandard_.entries;
-                break;
-            case TeraRaidMapParent::Kitakami:
-                table = (rc == RaidContent::Black)
-                    ? &kitakamiBlack_.entries
-                    : &kitakamiStandard_.entries;
-                break;
-            case TeraRaidMapParent::Blueberry:
-                table = (rc == RaidContent::Black)
-                    ? &blueberryBlack_.entries
-                    : &blueberryStandard_.entries;
-                break;
-        }
+    // Select encounter table (loaded on first use of this map/content)
+    const std::vector<EncounterTeraTF9>* table =
+        &encounterTable(map, rc == RaidContent::Black).entries;
 
-        if (!table || table->empty())
-            continue;
+    if (table->empty())
+        return false;
 
-        // Find encounter from seed
-        auto* enc = getEncounterFromSeed(slot.seed, *table, version, progress_, rc, map);
-        if (!enc)
-            continue;
+    ensureLocations(map);
+    ensureRewards();
 
-        // Generate pokemon details
-        RaidInfo info;
-        info.details = RaidCalc::generateData(slot.seed, *enc, id32_, personal_);
-        info.map = map;
-        info.content = rc;
-        info.slotIndex = startIndex + i;
-
-        // Look up coordinates
-        info.hasCoord = locations_.getCoord(map, slot.areaID, slot.lotteryGroup,
-                                            slot.spawnPointID, info.coord);
-
-        // Calculate rewards
-        info.rewards = rewardCalc_.calculateRewards(
-            slot.seed, info.details.stars,
-            enc->fixedRewardHash, enc->lotteryRewardHash,
-            info.details.species, info.details.teraType);
-
-        raids_.push_back(info);
-    }
+    // Find encounter from seed
+    auto* enc = getEncounterFromSeed(slot.seed, *table, version, progress_, rc, map);
+    if (!enc)
+        return false;
+
+    // Generate pokemon details
+    info.details = RaidCalc::generateData(slot.seed, *enc, id32_, personal_);
+    info.map = map;
+    info.content = rc;
+    info.slotIndex = slotIndex;
+
+    // Look up coordinates
+    info.hasCoord = locations_.getCoord(map, slot.areaID, slot.lotteryGroup,
+                                        slot.spawnPointID, info.coord);
+
+    // Calculate rewards
+    info.rewards = rewardCalc_.calculateRewards(
+        slot.seed, info.details.stars,
+        enc->fixedRewardHash, enc->lotteryRewardHash,
+        info.details.species, info.details.teraType);
+
+    return true;
 }
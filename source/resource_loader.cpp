@@ -0,0 +1,89 @@
+#include "resource_loader.h"
+#include "thread_util.h"
+#include <SDL2/SDL_image.h>
+
+ResourceLoader::~ResourceLoader() {
+    shutdown();
+}
+
+std::shared_future<void> ResourceLoader::enqueue(std::function<void()> job) {
+    std::packaged_task<void()> task(std::move(job));
+    std::shared_future<void> fut = task.get_future().share();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stopping_) {
+        // Late request after shutdown: nothing left to overlap with, run inline.
+        lock.unlock();
+        task();
+        return fut;
+    }
+    jobs_.push_back(std::move(task));
+    if (!worker_.joinable())
+        worker_ = std::thread(&ResourceLoader::workerLoop, this);
+    lock.unlock();
+    cv_.notify_one();
+    return fut;
+}
+
+void ResourceLoader::prefetchImage(const std::string& path) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (images_.count(path)) return;
+    }
+    // The surface is only written by the job and only read after `ready`.
+    auto slot = std::make_shared<ImageSlot>();
+    slot->ready = enqueue([slot, path] {
+        slot->surface = IMG_Load(path.c_str());
+    });
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    images_[path] = slot;
+}
+
+SDL_Surface* ResourceLoader::takeImage(const std::string& path) {
+    std::shared_ptr<ImageSlot> slot;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = images_.find(path);
+        if (it != images_.end()) {
+            slot = it->second;
+            images_.erase(it);
+        }
+    }
+    if (!slot) return IMG_Load(path.c_str());
+
+    slot->ready.wait();
+    return slot->surface;
+}
+
+void ResourceLoader::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) worker_.join();
+
+    for (auto& [path, slot] : images_) {
+        if (slot->ready.valid()) slot->ready.wait();
+        if (slot->surface) SDL_FreeSurface(slot->surface);
+    }
+    images_.clear();
+}
+
+void ResourceLoader::workerLoop() {
+    ThreadUtil::moveToSpareCore();
+
+    while (true) {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+            // Drain the queue even when stopping so no future is left unset.
+            if (jobs_.empty()) return;
+            task = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+        task();
+    }
+}
@@ -85,28 +85,6 @@ bool RewardCalc::loadTables(const std::string& fixedPath, const std::string& lot
     return true;
 }
 
-// Reward roll count by star rating (from RewardUtil.cs)
-static constexpr int REWARD_SLOTS[7][5] = {
-    {4, 5, 6, 7, 8},   // 1-star
-    {4, 5, 6, 7, 8},   // 2-star
-    {5, 6, 7, 8, 9},   // 3-star
-    {5, 6, 7, 8, 9},   // 4-star
-    {6, 7, 8, 9, 10},  // 5-star
-    {7, 8, 9, 10, 11}, // 6-star
-    {7, 8, 9, 10, 11}, // 7-star (mighty)
-};
-
-int RewardCalc::getRewardCount(uint64_t random, int stars) {
-    int idx = stars - 1;
-    if (idx < 0) idx = 0;
-    if (idx > 6) idx = 6;
-    if (random < 10) return REWARD_SLOTS[idx][0];
-    if (random < 40) return REWARD_SLOTS[idx][1];
-    if (random < 70) return REWARD_SLOTS[idx][2];
-    if (random < 90) return REWARD_SLOTS[idx][3];
-    return REWARD_SLOTS[idx][4];
-}
-
 uint16_t RewardCalc::getTeraShardId(uint8_t teraType) {
     // Type order: Normal=0, Fighting=1, Flying=2, Poison=3, Ground=4,
     //             Rock=5, Bug=6, Ghost=7, Steel=8, Fire=9, Water=10,
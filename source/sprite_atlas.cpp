@@ -0,0 +1,99 @@
+#include "sprite_atlas.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+
+constexpr size_t HEADER_SIZE = 12;
+constexpr size_t ENTRY_SIZE = 12;
+
+uint16_t readU16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+uint32_t readU32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+} // namespace
+
+bool SpriteAtlas::loadIndex(const std::string& path) {
+    free();
+    entries_.clear();
+
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (size < (long)HEADER_SIZE) { fclose(f); return false; }
+
+    std::vector<uint8_t> buf(size);
+    size_t read = fread(buf.data(), 1, size, f);
+    fclose(f);
+    if ((long)read != size) return false;
+
+    const uint8_t* p = buf.data();
+    if (readU32(p) != MAGIC || readU16(p + 4) != VERSION) return false;
+    uint16_t sheetCount = readU16(p + 6);
+    uint32_t count = readU32(p + 8);
+    if (sheetCount == 0 || HEADER_SIZE + (size_t)count * ENTRY_SIZE > (size_t)size)
+        return false;
+
+    entries_.resize(count);
+    for (uint32_t i = 0; i < count; i++) {
+        const uint8_t* e = p + HEADER_SIZE + i * ENTRY_SIZE;
+        Entry& out = entries_[i];
+        out.species = readU16(e);
+        out.form    = e[2];
+        out.sheet   = e[3];
+        out.x = readU16(e + 4);
+        out.y = readU16(e + 6);
+        out.w = readU16(e + 8);
+        out.h = readU16(e + 10);
+        if (out.sheet >= sheetCount) {
+            entries_.clear();
+            return false;
+        }
+    }
+    sheets_.assign(sheetCount, nullptr);
+    return true;
+}
+
+std::string SpriteAtlas::sheetPath(const std::string& dir, int index) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "sprites_%d.png", index);
+    return dir + name;
+}
+
+void SpriteAtlas::setSheet(int index, SDL_Texture* tex) {
+    if (index < 0 || index >= (int)sheets_.size()) {
+        if (tex) SDL_DestroyTexture(tex);
+        return;
+    }
+    if (sheets_[index]) SDL_DestroyTexture(sheets_[index]);
+    sheets_[index] = tex;
+}
+
+const SpriteAtlas::Entry* SpriteAtlas::lookup(uint16_t species, uint8_t form) const {
+    auto it = std::lower_bound(entries_.begin(), entries_.end(), std::make_pair(species, form),
+        [](const Entry& e, const std::pair<uint16_t, uint8_t>& k) {
+            return e.species != k.first ? e.species < k.first : e.form < k.second;
+        });
+    if (it != entries_.end() && it->species == species && it->form == form)
+        return &*it;
+    return nullptr;
+}
+
+bool SpriteAtlas::find(uint16_t species, uint8_t form, SDL_Texture*& tex, SDL_Rect& src) const {
+    const Entry* e = form != 0 ? lookup(species, form) : nullptr;
+    if (!e) e = lookup(species, 0);
+    if (!e || !sheets_[e->sheet]) return false;
+    tex = sheets_[e->sheet];
+    src = {e->x, e->y, e->w, e->h};
+    return true;
+}
+
+void SpriteAtlas::free() {
+    for (SDL_Texture* tex : sheets_)
+        if (tex) SDL_DestroyTexture(tex);
+    for (SDL_Texture*& tex : sheets_) tex = nullptr;
+}
@@ -0,0 +1,63 @@
+#include "sprite_cache.h"
+#include <SDL2/SDL_image.h>
+#include <algorithm>
+#include <cstdio>
+
+SDL_Texture* SpriteCache::load(SDL_Renderer* renderer, uint16_t species, uint8_t form) const {
+    char name[32];
+    SDL_Surface* surf = nullptr;
+    // Try form-specific sprite first (e.g. 058-1.png for Hisuian Growlithe).
+    if (form != 0) {
+        std::snprintf(name, sizeof(name), "%03d-%d.png", species, form);
+        surf = IMG_Load((dir_ + name).c_str());
+    }
+    // Fall back to base sprite (e.g. 058.png).
+    if (!surf) {
+        std::snprintf(name, sizeof(name), "%03d.png", species);
+        surf = IMG_Load((dir_ + name).c_str());
+    }
+    if (!surf) return nullptr;
+    SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer, surf);
+    SDL_FreeSurface(surf);
+    return tex;
+}
+
+void SpriteCache::rememberMissing(uint32_t key) {
+    if (missing_.size() < MAX_MISSING) {
+        missing_.push_back(key);
+        return;
+    }
+    missing_[missingNext_] = key;
+    missingNext_ = (missingNext_ + 1) % MAX_MISSING;
+}
+
+SDL_Texture* SpriteCache::get(SDL_Renderer* renderer, uint16_t species, uint8_t form) {
+    uint32_t key = makeKey(species, form);
+    auto it = std::find_if(resident_.begin(), resident_.end(),
+                           [key](const Entry& e) { return e.key == key; });
+    if (it != resident_.end()) {
+        std::rotate(resident_.begin(), it, it + 1);
+        return resident_.front().tex;
+    }
+    if (std::find(missing_.begin(), missing_.end(), key) != missing_.end())
+        return nullptr;
+
+    SDL_Texture* tex = load(renderer, species, form);
+    if (!tex) {
+        rememberMissing(key);
+        return nullptr;
+    }
+    if (resident_.size() >= MAX_TEXTURES) {
+        SDL_DestroyTexture(resident_.back().tex);
+        resident_.pop_back();
+    }
+    resident_.insert(resident_.begin(), Entry{key, tex});
+    return tex;
+}
+
+void SpriteCache::clear() {
+    for (const Entry& e : resident_) SDL_DestroyTexture(e.tex);
+    resident_.clear();
+    missing_.clear();
+    missingNext_ = 0;
+}
@@ -0,0 +1,212 @@
+#include "sv/sv_raid_core.h"
+#include "reward_calc.h"
+#include "shiny_util.h"
+#include "xoroshiro128plus.h"
+#include <algorithm>
+
+namespace {
+
+using SvRaidTables::Encounter;
+
+// getEncounterFromSeed over the compact tables.
+const Encounter* encounterFromSeed(uint32_t seed, TeraRaidMapParent map, bool black,
+                                   GameVersion version, GameProgress progress) {
+    Xoroshiro128Plus xoro(seed);
+    uint8_t stars = black ? 6 : getSeedStars(xoro, progress);
+    int16_t maxRate = RateTotals::getTotal(stars, map, version);
+    if (maxRate <= 0) return nullptr;
+    int rateRand = (int)xoro.nextInt((uint64_t)maxRate);
+
+    const SvRaidTables::Range& r = SvRaidTables::TABLES[(int)map][black ? 1 : 0];
+    for (const Encounter* e = SvRaidTables::ENCOUNTERS + r.offset,
+                        * end = e + r.count; e != end; ++e) {
+        if (e->stars != stars) continue;
+        int16_t minRate = version == GameVersion::Scarlet ? e->randRateMinScarlet
+                                                          : e->randRateMinViolet;
+        if (minRate < 0) continue;
+        if ((uint32_t)(rateRand - minRate) < e->randRate) return e;
+    }
+    return nullptr;
+}
+
+// RaidCalc::getTeraType with the encounter's baked personal types.
+uint8_t teraType(uint32_t seed, const Encounter& e) {
+    uint8_t specified;
+    if (gemTypeIsSpecified((GemType)e.gem, specified)) return specified;
+    Xoroshiro128Plus rand(seed);
+    if ((GemType)e.gem == GemType::Random) return (uint8_t)rand.nextInt(18);
+    return rand.nextInt(2) == 0 ? e.type1 : e.type2;
+}
+
+// The shiny half of RaidCalc::generateData: EC, fake TID and PID only.
+TeraShiny shinyState(uint32_t seed, const Encounter& e, uint32_t id32) {
+    Xoroshiro128Plus rand(seed);
+    rand.nextInt((uint64_t)UINT32_MAX);     // EC
+    uint32_t fakeTID = (uint32_t)rand.nextInt();
+    uint32_t pid = (uint32_t)rand.nextInt();
+
+    switch ((ShinyType)e.shiny) {
+        case ShinyType::Random: {
+            uint32_t x = ShinyUtil::getShinyXor(pid, fakeTID);
+            if (x >= 16) return TeraShiny::No;
+            return x == 0 ? TeraShiny::Square : TeraShiny::Star;
+        }
+        case ShinyType::Always: {
+            uint32_t x = ShinyUtil::getShinyXor(pid, fakeTID);
+            if (x > 16)
+                pid = ShinyUtil::getShinyPID((uint16_t)fakeTID, (uint16_t)(fakeTID >> 16), pid, 0);
+            if (!ShinyUtil::getIsShiny(id32, pid)) {
+                x = ShinyUtil::getShinyXor(pid, fakeTID);
+                pid = ShinyUtil::getShinyPID((uint16_t)(id32 & 0xFFFF), (uint16_t)(id32 >> 16),
+                                             pid, x == 0 ? 0u : 1u);
+            }
+            return ShinyUtil::getShinyXor(pid, fakeTID) == 0 ? TeraShiny::Square
+                                                             : TeraShiny::Star;
+        }
+        default:
+            return TeraShiny::No;
+    }
+}
+
+// RewardCalc::calculateRewards, counting rare items instead of listing them.
+// Tera shards and materials (item id 0 in the tables) are never rare.
+void rareRewards(uint32_t seed, const Encounter& e, SvRaid& out) {
+    out.rareCount = 0;
+    out.rareItem = 0;
+    auto take = [&](uint16_t id) {
+        if (!RewardCalc::isRareItem(id)) return;
+        if (out.rareCount++ == 0) out.rareItem = id;
+    };
+
+    if (e.fixedTable >= 0) {
+        const SvRaidTables::Range& f = SvRaidTables::FIXED_TABLES[e.fixedTable];
+        for (int i = 0; i < f.count; i++) take(SvRaidTables::FIXED_ITEMS[f.offset + i]);
+    }
+    if (e.lotteryTable < 0) return;
+    const SvRaidTables::LotteryTable& lt = SvRaidTables::LOTTERY_TABLES[e.lotteryTable];
+    if (lt.count == 0 || lt.totalRate == 0) return;
+
+    const SvRaidTables::LotteryItem* items = SvRaidTables::LOTTERY_ITEMS + lt.offset;
+    Xoroshiro128Plus rng(seed);
+    int amount = RewardCalc::getRewardCount(rng.nextInt(100), e.stars);
+    for (int i = 0; i < amount; i++) {
+        int threshold = (int)rng.nextInt((uint64_t)lt.totalRate);
+        for (int j = 0; j < lt.count; j++) {
+            if ((int)items[j].rate > threshold) {
+                take(items[j].itemId);
+                break;
+            }
+            threshold -= items[j].rate;
+        }
+    }
+}
+
+} // anonymous
+
+bool SvRaidCore::resolve(const TeraRaidDetail& slot, TeraRaidMapParent map,
+                         GameVersion version, GameProgress progress, uint32_t id32,
+                         SvRaid& out) {
+    if (!slot.isEnabled || slot.areaID == 0) return false;
+    RaidContent rc = slot.raidContent();
+    if (rc == RaidContent::Event || rc == RaidContent::Event_Mighty) return false;
+
+    bool black = rc == RaidContent::Black;
+    const Encounter* e = encounterFromSeed(slot.seed, map, black, version, progress);
+    if (!e) return false;
+
+    out.encounter = e;
+    out.seed      = slot.seed;
+    out.map       = map;
+    out.black     = black;
+    out.stars     = e->stars;
+    out.teraType  = teraType(slot.seed, *e);
+    out.shiny     = shinyState(slot.seed, *e, id32);
+    rareRewards(slot.seed, *e, out);
+    return true;
+}
+
+void SvRaidCore::parseSlots(const uint8_t* base, int count, TeraRaidMapParent map,
+                            GameVersion version, GameProgress progress, uint32_t id32,
+                            int startIndex) {
+    for (int i = 0; i < count; i++) {
+        SvRaid raid;
+        if (!resolve(TeraRaidDetail::readFrom(base + i * TeraRaidDetail::SIZE),
+                     map, version, progress, id32, raid))
+            continue;
+        raid.slotIndex = (uint16_t)(startIndex + i);
+        raids_.push_back(raid);
+    }
+}
+
+size_t SvRaidCore::parse(const uint8_t* paldea, size_t paldeaLen,
+                         const uint8_t* dlc, size_t dlcLen,
+                         GameVersion version, GameProgress progress, uint32_t id32) {
+    // Same slot layout as RaidBlockData::parsePaldea / parseDLC.
+    constexpr int SLOT = TeraRaidDetail::SIZE;
+    constexpr size_t DLC_REGION = 0xC80;
+    raids_.clear();
+    if (paldeaLen >= 0x10) {
+        int count = std::min<int>(PALDEA_SLOTS, (int)((paldeaLen - 0x10) / SLOT));
+        parseSlots(paldea + 0x10, count, TeraRaidMapParent::Paldea,
+                   version, progress, id32, 0);
+    }
+    if (dlcLen >= DLC_REGION)
+        parseSlots(dlc, KITAKAMI_SLOTS, TeraRaidMapParent::Kitakami,
+                   version, progress, id32, PALDEA_SLOTS);
+    if (dlcLen >= 2 * DLC_REGION)
+        parseSlots(dlc + DLC_REGION, BLUEBERRY_SLOTS, TeraRaidMapParent::Blueberry,
+                   version, progress, id32, PALDEA_SLOTS + KITAKAMI_SLOTS);
+    return raids_.size();
+}
+
+bool SvRaidCore::readLive(GameVersion version) {
+    raids_.clear();
+    DmntMem::Session session;
+    if (!DmntMem::readBlock(DmntPointers::KTeraRaidPaldea, DmntPointers::KTeraRaidPaldeaLen,
+                            paldeaRaw_, sizeof(paldeaRaw_)) ||
+        !DmntMem::readBlock(DmntPointers::KTeraRaidDLC, DmntPointers::KTeraRaidDLCLen,
+                            dlcRaw_, sizeof(dlcRaw_)))
+        return false;
+
+    uint32_t id32 = 0;
+    if (DmntMem::readBlock(DmntPointers::KMyStatus, DmntPointers::KMyStatusLen,
+                           statusRaw_, sizeof(statusRaw_)))
+        id32 = statusRaw_[0] | (statusRaw_[1] << 8) | (statusRaw_[2] << 16) |
+               ((uint32_t)statusRaw_[3] << 24);
+
+    parse(paldeaRaw_, sizeof(paldeaRaw_), dlcRaw_, sizeof(dlcRaw_),
+          version, GameProgress::Unlocked6Stars, id32);
+    return !raids_.empty();
+}
+
+SvMapStats SvRaidCore::mapStats(TeraRaidMapParent map) const {
+    SvMapStats st;
+    for (const SvRaid& r : raids_) {
+        if (r.map != map) continue;
+        st.total++;
+        if (r.shiny != TeraShiny::No) st.shiny++;
+        if (r.black) st.black++;
+        if (r.rareCount > 0) st.rare++;
+    }
+    return st;
+}
+
+size_t SvRaidCore::topRaids(TeraRaidMapParent map, int* out, size_t max) const {
+    FixedVector<int, MAX_RAIDS> idx;
+    for (int i = 0; i < (int)raids_.size(); i++)
+        if (raids_[i].map == map) idx.push_back(i);
+
+    auto better = [&](int a, int b) {
+        const SvRaid& x = raids_[a];
+        const SvRaid& y = raids_[b];
+        bool xs = x.shiny != TeraShiny::No, ys = y.shiny != TeraShiny::No;
+        if (xs != ys) return xs;
+        if (x.rareCount != y.rareCount) return x.rareCount > y.rareCount;
+        if (x.stars != y.stars) return x.stars > y.stars;
+        return x.slotIndex < y.slotIndex;
+    };
+    size_t n = std::min(max, idx.size());
+    std::partial_sort(idx.begin(), idx.begin() + n, idx.end(), better);
+    std::copy(idx.begin(), idx.begin() + n, out);
+    return n;
+}
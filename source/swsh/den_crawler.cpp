@@ -6,41 +6,90 @@
 #include "swish_crypto.h"
 #include "sc_block.h"
 #include <cstdio>
+#include <cstring>
 
-#ifdef __SWITCH__
 #include "dmnt_mem.h"
-#endif
 
 namespace {
     constexpr uint32_t KEY_RAID_GALAR = 0x9033eb7b;
     constexpr uint32_t KEY_RAID_IOA   = 0x158DA896;
     constexpr uint32_t KEY_RAID_CT    = 0x148DA703;
+
+    struct LiveRegion {
+        SwShDenRegion region;
+        uint64_t heapOffset;
+        int count;
+        int hashIndexBase;
+    };
+
+    constexpr LiveRegion LIVE_REGIONS[] = {
+        {SwShDenRegion::Vanilla,       SwShOffsets::DEN_VANILLA,      SwShOffsets::DEN_COUNT_VANILLA, 0},
+        {SwShDenRegion::IslandOfArmor, SwShOffsets::DEN_ISLAND_ARMOR, SwShOffsets::DEN_COUNT_IOA,     100},
+        {SwShDenRegion::CrownTundra,   SwShOffsets::DEN_CROWN_TUNDRA, SwShOffsets::DEN_COUNT_CT,      190},
+    };
+
+    // Dens the den lists show by default: active, with a resolved encounter.
+    bool isListed(const SwShDenInfo& info) {
+        return info.isActive && info.species > 0;
+    }
 }
 
 bool DenCrawler::readLive(GameVersion version) {
     dens_.clear();
     version_ = version;
 
-#ifdef __SWITCH__
-    bool ok = true;
-    ok &= readRegion(SwShDenRegion::Vanilla,
-                     SwShOffsets::DEN_VANILLA,
-                     SwShOffsets::DEN_COUNT_VANILLA, 0);
-    ok &= readRegion(SwShDenRegion::IslandOfArmor,
-                     SwShOffsets::DEN_ISLAND_ARMOR,
-                     SwShOffsets::DEN_COUNT_IOA, 100);
-    ok &= readRegion(SwShDenRegion::CrownTundra,
-                     SwShOffsets::DEN_CROWN_TUNDRA,
-                     SwShOffsets::DEN_COUNT_CT, 190);
-    return ok;
-#else
-    return false;
-#endif
+    // One heap read per region; the bytes are kept as the watch snapshot.
+    haveLiveRaw_ = readLiveRaw(liveRaw_);
+    if (!haveLiveRaw_) return false;
+    for (const auto& r : LIVE_REGIONS) {
+        const uint8_t* data = liveRaw_ + r.hashIndexBase * SwShDenData::SIZE;
+        readRegionFromBuffer(r.region, data, r.count * SwShDenData::SIZE,
+                             r.count, r.hashIndexBase);
+    }
+    return true;
+}
+
+bool DenCrawler::readLiveRaw(uint8_t* raw) const {
+    for (const auto& r : LIVE_REGIONS) {
+        if (!DmntMem::readHeap(r.heapOffset, raw + r.hashIndexBase * SwShDenData::SIZE,
+                               r.count * SwShDenData::SIZE))
+            return false;
+    }
+    return true;
+}
+
+bool DenCrawler::pollLive(std::vector<DenPatch>& out) {
+    if (!haveLiveRaw_ || !readLiveRaw(pollRaw_)) return false;
+    if (std::memcmp(pollRaw_, liveRaw_, RAW_SIZE) == 0) return false;
+
+    size_t before = out.size();
+    for (const auto& r : LIVE_REGIONS) {
+        for (int i = 0; i < r.count; i++) {
+            int index = r.hashIndexBase + i;
+            size_t off = (size_t)index * SwShDenData::SIZE;
+            if (std::memcmp(pollRaw_ + off + DIFF_BEGIN, liveRaw_ + off + DIFF_BEGIN,
+                            DIFF_END - DIFF_BEGIN) == 0)
+                continue;
+            DenPatch patch{index, decodeDen(r.region, pollRaw_ + off, index)};
+            predict(patch.info);
+            out.push_back(patch);
+        }
+    }
+    std::memcpy(liveRaw_, pollRaw_, RAW_SIZE);
+    return out.size() > before;
+}
+
+void DenCrawler::applyPatches(const std::vector<DenPatch>& patches) {
+    for (const auto& patch : patches) {
+        if (patch.denIndex >= 0 && patch.denIndex < (int)dens_.size())
+            dens_[patch.denIndex] = patch.info;
+    }
 }
 
 bool DenCrawler::readSave(const std::string& savePath, GameVersion version) {
     dens_.clear();
     version_ = version;
+    haveLiveRaw_ = false;
 
     FILE* f = fopen(savePath.c_str(), "rb");
     if (!f) return false;
@@ -82,116 +131,104 @@ bool DenCrawler::readRegionFromBuffer(SwShDenRegion region, const uint8_t* data,
     const size_t needed = count * SwShDenData::SIZE;
     if (dataSize < needed) return false;
 
-    for (int i = 0; i < count; i++) {
-        SwShDenData den{};
-        std::memcpy(den.raw, data + i * SwShDenData::SIZE, SwShDenData::SIZE);
-
-        SwShDenInfo info{};
-        info.denIndex   = hashIndexBase + i;
-        info.region     = region;
-        info.seed       = den.seed();
-        info.stars      = den.stars();
-        info.isActive   = den.isActive();
-        info.isRare     = den.isRare();
-        info.isEvent    = den.isEvent();
-        info.species    = 0;
-        info.flawlessIVs = 0;
-        for (int j = 0; j < 6; j++) info.ivs[j] = 0;
-        info.shinyType  = SwShShinyType::None;
-        info.shinyAdvance = 0;
-
-        resolveEncounter(den, info.denIndex, info.species, info.flawlessIVs);
-
-        if (!info.isActive || !info.isEvent) {
-            info.shinyType = predictShiny(info.seed, 10000, info.shinyAdvance);
-        }
+    for (int i = 0; i < count; i++)
+        dens_.push_back(decodeDen(region, data + i * SwShDenData::SIZE, hashIndexBase + i));
+    return true;
+}
 
-        // Generate IVs from seed (RNG calls: EC, TID, PID, then IVs)
-        if (info.species > 0) {
-            Xoroshiro128Plus rng(info.seed);
-            rng.next();  // EC
-            rng.next();  // fake TID
-            rng.next();  // PID
-
-            for (int j = 0; j < 6; j++) info.ivs[j] = -1;
-            for (int j = 0; j < info.flawlessIVs; j++) {
-                int idx;
-                do { idx = (int)rng.nextInt(6); }
-                while (info.ivs[idx] != -1);
-                info.ivs[idx] = 31;
-            }
-            for (int j = 0; j < 6; j++) {
-                if (info.ivs[j] == -1)
-                    info.ivs[j] = (int)rng.nextInt(32);
-            }
+SwShDenInfo DenCrawler::decodeDen(SwShDenRegion region, const uint8_t* raw, int denIndex) const {
+    SwShDenData den{};
+    std::memcpy(den.raw, raw, SwShDenData::SIZE);
+
+    SwShDenInfo info{};
+    info.denIndex   = denIndex;
+    info.region     = region;
+    info.seed       = den.seed();
+    info.stars      = den.stars();
+    info.isActive   = den.isActive();
+    info.isRare     = den.isRare();
+    info.isEvent    = den.isEvent();
+    info.species    = 0;
+    info.flawlessIVs = 0;
+    for (int j = 0; j < 6; j++) info.ivs[j] = 0;
+    info.shinyType  = SwShShinyType::None;
+    info.shinyAdvance = 0;
+    // Active event dens have no seed-based encounter to search.
+    info.shinyKnown = info.isActive && info.isEvent;
+
+    resolveEncounter(den, info.denIndex, info.species, info.flawlessIVs);
+
+    // Generate IVs from seed (RNG calls: EC, TID, PID, then IVs)
+    if (info.species > 0) {
+        Xoroshiro128Plus rng(info.seed);
+        rng.next();  // EC
+        rng.next();  // fake TID
+        rng.next();  // PID
+
+        for (int j = 0; j < 6; j++) info.ivs[j] = -1;
+        for (int j = 0; j < info.flawlessIVs; j++) {
+            int idx;
+            do { idx = (int)rng.nextInt(6); }
+            while (info.ivs[idx] != -1);
+            info.ivs[idx] = 31;
+        }
+        for (int j = 0; j < 6; j++) {
+            if (info.ivs[j] == -1)
+                info.ivs[j] = (int)rng.nextInt(32);
         }
-
-        dens_.push_back(info);
     }
-    return true;
+    return info;
 }
 
-bool DenCrawler::readRegion(SwShDenRegion region, uint64_t heapOffset,
-                            int count, int hashIndexBase) {
-#ifdef __SWITCH__
-    const size_t blockSize = count * SwShDenData::SIZE;
-    uint8_t buf[SwShOffsets::DEN_COUNT_VANILLA * SwShDenData::SIZE]; // largest region
-    if (blockSize > sizeof(buf)) return false;
-
-    if (!DmntMem::readHeap(heapOffset, buf, blockSize))
-        return false;
+void DenCrawler::predict(SwShDenInfo& info) {
+    if (info.shinyKnown) return;
+    info.shinyType = cachedShiny(info.seed, info.shinyAdvance);
+    info.shinyKnown = true;
+}
 
-    for (int i = 0; i < count; i++) {
-        SwShDenData den{};
-        std::memcpy(den.raw, buf + i * SwShDenData::SIZE, SwShDenData::SIZE);
-
-        SwShDenInfo info{};
-        info.denIndex   = hashIndexBase + i;
-        info.region     = region;
-        info.seed       = den.seed();
-        info.stars      = den.stars();
-        info.isActive   = den.isActive();
-        info.isRare     = den.isRare();
-        info.isEvent    = den.isEvent();
-        info.species    = 0;
-        info.flawlessIVs = 0;
-        for (int j = 0; j < 6; j++) info.ivs[j] = 0;
-        info.shinyType  = SwShShinyType::None;
-        info.shinyAdvance = 0;
-
-        resolveEncounter(den, info.denIndex, info.species, info.flawlessIVs);
-
-        if (!info.isActive || !info.isEvent) {
-            info.shinyType = predictShiny(info.seed, 10000, info.shinyAdvance);
+size_t DenCrawler::predictPending(SwShDenRegion region, size_t budget) {
+    size_t pending = 0;
+    for (SwShDenInfo& info : dens_) {
+        if (info.region != region || info.shinyKnown || !isListed(info)) continue;
+        if (budget > 0) {
+            predict(info);
+            budget--;
+        } else {
+            pending++;
         }
+    }
+    return pending;
+}
 
-        // Generate IVs from seed (RNG calls: EC, TID, PID, then IVs)
-        if (info.species > 0) {
-            Xoroshiro128Plus rng(info.seed);
-            rng.next();  // EC
-            rng.next();  // fake TID
-            rng.next();  // PID
-
-            for (int j = 0; j < 6; j++) info.ivs[j] = -1;
-            for (int j = 0; j < info.flawlessIVs; j++) {
-                int idx;
-                do { idx = (int)rng.nextInt(6); }
-                while (info.ivs[idx] != -1);
-                info.ivs[idx] = 31;
-            }
-            for (int j = 0; j < 6; j++) {
-                if (info.ivs[j] == -1)
-                    info.ivs[j] = (int)rng.nextInt(32);
-            }
-        }
+void DenCrawler::predictAll() {
+    for (SwShDenInfo& info : dens_) predict(info);
+}
 
-        dens_.push_back(info);
+SwShRegionStats DenCrawler::regionStats(SwShDenRegion region, uint32_t nearFrames) const {
+    SwShRegionStats st;
+    for (const SwShDenInfo& info : dens_) {
+        if (info.region != region) continue;
+        st.total++;
+        if (info.isActive) st.active++;
+        if (!isListed(info)) continue;
+        st.listed++;
+        if (!info.shinyKnown) st.pending++;
+        else if (info.shinyType != SwShShinyType::None && info.shinyAdvance <= nearFrames)
+            st.shinyWithin++;
     }
-    return true;
-#else
-    (void)region; (void)heapOffset; (void)count; (void)hashIndexBase;
-    return false;
-#endif
+    return st;
+}
+
+SwShShinyType DenCrawler::cachedShiny(uint64_t seed, uint32_t& outAdvance) {
+    auto it = shinyMemo_.find(seed);
+    if (it != shinyMemo_.end()) {
+        outAdvance = it->second.advance;
+        return it->second.type;
+    }
+    SwShShinyType type = predictShiny(seed, SHINY_SEARCH, outAdvance);
+    if (shinyMemo_.size() >= SHINY_MEMO_MAX) shinyMemo_.clear();
+    shinyMemo_.emplace(seed, {type, outAdvance});
+    return type;
 }
 
 void DenCrawler::resolveEncounter(const SwShDenData& den, int globalIndex,
@@ -43,6 +43,7 @@ bool UI::init() {
     }
 
     SDL_SetRenderDrawBlendMode(renderer_, SDL_BLENDMODE_BLEND);
+    glyphs_.setRenderer(renderer_);
 
 #ifdef __SWITCH__
     PlFontData fontData;
@@ -76,7 +77,12 @@ bool UI::init() {
 }
 
 void UI::shutdown() {
-    freeTextCache();
+    raidWatch_.stop();
+    denWatch_.stop();
+    plaWatch_.stop();
+    cancelPlaDeepSearch();
+    loader_.shutdown();
+    glyphs_.free();
     freeSprites();
     freeGameIcons();
     account_.freeTextures();
@@ -175,6 +181,90 @@ void UI::showSplash() {
     SDL_DestroyTexture(tex);
 }
 
+// --- Background loading ---
+
+std::string UI::dataDir() {
+#ifdef __SWITCH__
+    return "romfs:/data/";
+#else
+    return "romfs/data/";
+#endif
+}
+
+std::string UI::mapDir() {
+#ifdef __SWITCH__
+    return "romfs:/maps/";
+#else
+    return "romfs/maps/";
+#endif
+}
+
+void UI::preloadCommon() {
+    prefetchSpriteAtlas();
+    std::string dir = dataDir();
+    if (!textReady_.valid() && !textDataLoaded_)
+        textReady_ = loader_.enqueue([this, dir] { readTextData(dir); });
+    if (!personalReady_.valid() && !personalLoaded_)
+        personalReady_ = loader_.enqueue([this, dir] {
+            personalLoaded_ = personal_.load(dir + "personal_sv");
+        });
+}
+
+void UI::preload(GameVersion game) {
+    preloadCommon();
+    if (!isSwSh(game) && !isPLA(game) && !readerReady_.valid() && !readerLoaded_) {
+        std::string dir = dataDir();
+        readerReady_ = loader_.enqueue([this, dir] {
+            readerLoaded_ = reader_.loadResources(dir);
+            // Raids almost always include Paldea; warm its tables too.
+            if (readerLoaded_) reader_.ensureMapLoaded(TeraRaidMapParent::Paldea);
+        });
+    }
+    prefetchMaps(game);
+}
+
+void UI::prefetchMaps(GameVersion game) {
+    std::string dir = mapDir();
+    if (isPLA(game)) {
+        for (int r = 0; r < (int)PlaRegion::Count; r++)
+            if (!plaMaps_[r]) loader_.prefetchImage(dir + plaRegionMapFile((PlaRegion)r));
+    } else if (isSwSh(game)) {
+        if (!mapWildArea_) loader_.prefetchImage(dir + "wild_area.png");
+        if (!mapIoA_) loader_.prefetchImage(dir + "isle_of_armor.png");
+        if (!mapCT_) loader_.prefetchImage(dir + "crown_tundra.png");
+    } else {
+        if (!mapPaldea_) loader_.prefetchImage(dir + "paldea.jpg");
+        if (!mapKitakami_) loader_.prefetchImage(dir + "kitakami.jpg");
+        if (!mapBlueberry_) loader_.prefetchImage(dir + "blueberry.jpg");
+    }
+}
+
+SDL_Texture* UI::loadMapTexture(const char* name) {
+    // Decoded on the loader thread if prefetched; the upload must happen here.
+    SDL_Surface* surf = loader_.takeImage(mapDir() + name);
+    if (!surf) return nullptr;
+    SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer_, surf);
+    SDL_FreeSurface(surf);
+    return tex;
+}
+
+bool UI::loadRaidResources() {
+    if (readerReady_.valid()) {
+        readerReady_.wait();
+        readerReady_ = {};
+    }
+    if (!readerLoaded_) readerLoaded_ = reader_.loadResources(dataDir());
+    return readerLoaded_;
+}
+
+void UI::loadPersonal() {
+    if (personalReady_.valid()) {
+        personalReady_.wait();
+        personalReady_ = {};
+    }
+    if (!personalLoaded_) personalLoaded_ = personal_.load(dataDir() + "personal_sv");
+}
+
 void UI::showMessageAndWait(const std::string& title, const std::string& body) {
     if (!renderer_) return;
     bool waiting = true;
@@ -295,34 +385,18 @@ void UI::runLive(const std::string& basePath, GameVersion game) {
 
     showWorking("Loading resources...");
 
-    // Load text data
-#ifdef __SWITCH__
-    std::string dataDir = "romfs:/data/";
-    std::string mapDir  = "romfs:/maps/";
-#else
-    std::string dataDir = "romfs/data/";
-    std::string mapDir  = "romfs/maps/";
-#endif
-
-    loadTextData(dataDir);
+    // Load text data (already in flight if preload() ran during the splash)
+    loadTextData(dataDir());
 
-    if (!reader_.loadResources(dataDir)) {
+    if (!loadRaidResources()) {
         showMessageAndWait("Error", "Failed to load encounter data.");
         return;
     }
 
     // Load map images
-    auto loadMap = [&](const char* name) -> SDL_Texture* {
-        std::string path = mapDir + name;
-        SDL_Surface* surf = IMG_Load(path.c_str());
-        if (!surf) return nullptr;
-        SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer_, surf);
-        SDL_FreeSurface(surf);
-        return tex;
-    };
-    if (!mapPaldea_) mapPaldea_ = loadMap("paldea.jpg");
-    if (!mapKitakami_) mapKitakami_ = loadMap("kitakami.jpg");
-    if (!mapBlueberry_) mapBlueberry_ = loadMap("blueberry.jpg");
+    if (!mapPaldea_) mapPaldea_ = loadMapTexture("paldea.jpg");
+    if (!mapKitakami_) mapKitakami_ = loadMapTexture("kitakami.jpg");
+    if (!mapBlueberry_) mapBlueberry_ = loadMapTexture("blueberry.jpg");
 
     // Read raids from live game memory
     showWorking("Reading raids from memory...");
@@ -332,6 +406,9 @@ void UI::runLive(const std::string& basePath, GameVersion game) {
         return;
     }
 
+    // Encounter/location tables load on demand; record what this session paid for.
+    reader_.writeLoadReport(basePath_ + "load_times.txt");
+
     // Start on Paldea
     currentMap_ = TeraRaidMapParent::Paldea;
     raidCursor_ = 0;
@@ -343,6 +420,11 @@ void UI::runLive(const std::string& basePath, GameVersion game) {
 
     screen_ = AppScreen::RaidView;
 
+    // From here on the watch thread owns memory reads.
+    raidWatch_.start(WATCH_INTERVAL_MS, [this, game](std::vector<RaidPatch>& out) {
+        return reader_.pollLive(game, out);
+    });
+
     dirty_ = true;
     bool running = true;
     while (running) {
@@ -363,6 +445,7 @@ void UI::runLive(const std::string& basePath, GameVersion game) {
         }
 
         if (showAbout_ != aboutBefore) markDirty();
+        if (raidWatch_.take(raidPatches_)) applyRaidPatches();
 
         if (dirty_) {
             drawRaidViewFrame();
@@ -372,6 +455,7 @@ void UI::runLive(const std::string& basePath, GameVersion game) {
         }
         SDL_Delay(16);
     }
+    raidWatch_.stop();
 }
 
 // --- Profile Selector ---
@@ -696,34 +780,20 @@ void UI::handleGameSelectorInput(bool& running) {
 
 void UI::selectGame(GameVersion game) {
     selectedVersion_ = game;
-    freeTextCache();
 
     showWorking("Loading resources...");
 
-#ifdef __SWITCH__
-    std::string dataDir = "romfs:/data/";
-    std::string mapDir  = "romfs:/maps/";
-#else
-    std::string dataDir = "romfs/data/";
-    std::string mapDir  = "romfs/maps/";
-#endif
+    // Decode this game's maps in the background while the save is read.
+    prefetchMaps(game);
 
     if (isSwSh(game)) {
         // --- Sword / Shield save file path ---
-        loadTextData(dataDir);
-        personal_.load(dataDir + "personal_sv");
+        loadTextData(dataDir());
+        loadPersonal();
 
-        auto loadMap = [&](const char* name) -> SDL_Texture* {
-            std::string path = mapDir + name;
-            SDL_Surface* surf = IMG_Load(path.c_str());
-            if (!surf) return nullptr;
-            SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer_, surf);
-            SDL_FreeSurface(surf);
-            return tex;
-        };
-        if (!mapWildArea_) mapWildArea_ = loadMap("wild_area.png");
-        if (!mapIoA_) mapIoA_ = loadMap("isle_of_armor.png");
-        if (!mapCT_) mapCT_ = loadMap("crown_tundra.png");
+        if (!mapWildArea_) mapWildArea_ = loadMapTexture("wild_area.png");
+        if (!mapIoA_) mapIoA_ = loadMapTexture("isle_of_armor.png");
+        if (!mapCT_) mapCT_ = loadMapTexture("crown_tundra.png");
 
         showWorking("Reading save file...");
 
@@ -752,6 +822,7 @@ void UI::selectGame(GameVersion game) {
 #ifdef __SWITCH__
         account_.unmountSave();
 #endif
+        denCrawler_.predictAll();
 
         liveMode_ = false;
         swshTab_ = 0;
@@ -799,25 +870,17 @@ void UI::selectGame(GameVersion game) {
     // --- Scarlet / Violet save file path ---
 
     // Load text data
-    loadTextData(dataDir);
+    loadTextData(dataDir());
 
-    if (!reader_.loadResources(dataDir)) {
+    if (!loadRaidResources()) {
         showMessageAndWait("Error", "Failed to load encounter data.");
         return;
     }
 
     // Load map images
-    auto loadMap = [&](const char* name) -> SDL_Texture* {
-        std::string path = mapDir + name;
-        SDL_Surface* surf = IMG_Load(path.c_str());
-        if (!surf) return nullptr;
-        SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer_, surf);
-        SDL_FreeSurface(surf);
-        return tex;
-    };
-    if (!mapPaldea_) mapPaldea_ = loadMap("paldea.jpg");
-    if (!mapKitakami_) mapKitakami_ = loadMap("kitakami.jpg");
-    if (!mapBlueberry_) mapBlueberry_ = loadMap("blueberry.jpg");
+    if (!mapPaldea_) mapPaldea_ = loadMapTexture("paldea.jpg");
+    if (!mapKitakami_) mapKitakami_ = loadMapTexture("kitakami.jpg");
+    if (!mapBlueberry_) mapBlueberry_ = loadMapTexture("blueberry.jpg");
 
     // Mount + read save
     showWorking("Reading save file...");
@@ -848,6 +911,8 @@ void UI::selectGame(GameVersion game) {
     account_.unmountSave();
 #endif
 
+    reader_.writeLoadReport(basePath_ + "load_times.txt");
+
     // Start on Paldea
     currentMap_ = TeraRaidMapParent::Paldea;
     raidCursor_ = 0;
@@ -927,57 +992,20 @@ void UI::drawAboutPopup() {
 
 // --- Rendering helpers ---
 
-UI::TextCacheEntry& UI::getCachedText(const std::string& text, SDL_Color color, TTF_Font* f) {
-    uint32_t cp = (uint32_t)color.r | ((uint32_t)color.g << 8) |
-                  ((uint32_t)color.b << 16) | ((uint32_t)color.a << 24);
-    TextCacheKey key{text, f, cp};
-    auto it = textCache_.find(key);
-    if (it != textCache_.end())
-        return it->second;
-
-    SDL_Surface* surf = TTF_RenderUTF8_Blended(f, text.c_str(), color);
-    TextCacheEntry entry{nullptr, 0, 0};
-    if (surf) {
-        entry.tex = SDL_CreateTextureFromSurface(renderer_, surf);
-        entry.w = surf->w;
-        entry.h = surf->h;
-        SDL_FreeSurface(surf);
-    }
-    return textCache_.emplace(std::move(key), entry).first->second;
-}
-
-void UI::freeTextCache() {
-    for (auto& [k, e] : textCache_) {
-        if (e.tex) SDL_DestroyTexture(e.tex);
-    }
-    textCache_.clear();
-}
-
 void UI::drawText(const std::string& text, int x, int y, SDL_Color color, TTF_Font* f) {
     if (!f || text.empty()) return;
-    auto& entry = getCachedText(text, color, f);
-    if (entry.tex) {
-        SDL_Rect dst = {x, y, entry.w, entry.h};
-        SDL_RenderCopy(renderer_, entry.tex, nullptr, &dst);
-    }
+    glyphs_.draw(f, text, x, y, color);
 }
 
 void UI::drawTextCentered(const std::string& text, int cx, int cy, SDL_Color color, TTF_Font* f) {
     if (!f || text.empty()) return;
-    auto& entry = getCachedText(text, color, f);
-    if (entry.tex) {
-        SDL_Rect dst = {cx - entry.w / 2, cy - entry.h / 2, entry.w, entry.h};
-        SDL_RenderCopy(renderer_, entry.tex, nullptr, &dst);
-    }
+    int w = glyphs_.measure(f, text);
+    glyphs_.draw(f, text, cx - w / 2, cy - glyphs_.height(f) / 2, color);
 }
 
 void UI::drawTextRight(const std::string& text, int rx, int y, SDL_Color color, TTF_Font* f) {
     if (!f || text.empty()) return;
-    auto& entry = getCachedText(text, color, f);
-    if (entry.tex) {
-        SDL_Rect dst = {rx - entry.w, y, entry.w, entry.h};
-        SDL_RenderCopy(renderer_, entry.tex, nullptr, &dst);
-    }
+    glyphs_.draw(f, text, rx - glyphs_.measure(f, text), y, color);
 }
 
 void UI::drawRect(int x, int y, int w, int h, SDL_Color color) {
@@ -1047,50 +1075,83 @@ void UI::updateStick(int16_t axisX, int16_t axisY) {
 
 // --- Sprites ---
 
-SDL_Texture* UI::getSprite(uint16_t species, uint8_t form) {
-    uint32_t key = (uint32_t)species | ((uint32_t)form << 16);
-    auto it = spriteCache_.find(key);
-    if (it != spriteCache_.end())
-        return it->second;
-
-    auto tryLoad = [&](const char* filename) -> SDL_Texture* {
-        std::string path = std::string("romfs:/sprites/") + filename;
-        SDL_Surface* surf = IMG_Load(path.c_str());
-        if (!surf) return nullptr;
-        SDL_Texture* t = SDL_CreateTextureFromSurface(renderer_, surf);
-        SDL_FreeSurface(surf);
-        return t;
-    };
+std::string UI::atlasDir() {
+#ifdef __SWITCH__
+    return "romfs:/atlas/";
+#else
+    return "romfs/atlas/";
+#endif
+}
 
-    SDL_Texture* tex = nullptr;
-    char filename[64];
+// Read the atlas index and queue the sheet decodes on the loader thread.
+void UI::prefetchSpriteAtlas() {
+    if (spriteAtlas_.hasIndex()) return;
+    if (!spriteAtlas_.loadIndex(atlasDir() + "sprites.bin")) return;
+    for (int i = 0; i < spriteAtlas_.sheetCount(); i++)
+        loader_.prefetchImage(SpriteAtlas::sheetPath(atlasDir(), i));
+}
 
-    // Try form-specific sprite first (e.g. 058-1.png for Hisuian Growlithe).
-    if (form != 0) {
-        std::snprintf(filename, sizeof(filename), "%03d-%d.png", species, form);
-        tex = tryLoad(filename);
+void UI::attachSpriteAtlas() {
+    spriteAtlasAttached_ = true;
+    prefetchSpriteAtlas();
+    for (int i = 0; i < spriteAtlas_.sheetCount(); i++) {
+        if (spriteAtlas_.hasSheet(i)) continue;
+        SDL_Surface* surf = loader_.takeImage(SpriteAtlas::sheetPath(atlasDir(), i));
+        if (!surf) continue;
+        spriteAtlas_.setSheet(i, SDL_CreateTextureFromSurface(renderer_, surf));
+        SDL_FreeSurface(surf);
     }
-    // Fall back to base sprite (e.g. 058.png).
-    if (!tex) {
-        std::snprintf(filename, sizeof(filename), "%03d.png", species);
-        tex = tryLoad(filename);
+}
+
+// Loose sprites are not shipped (romfs carries only the atlas); this SD card
+// folder is for sprites the atlas lacks, e.g. species added after it was packed.
+std::string UI::spriteDir() {
+#ifdef __SWITCH__
+    return "sdmc:/switch/pkTeraRaid/sprites/";
+#else
+    return "sprites/";
+#endif
+}
+
+void UI::drawSprite(uint16_t species, uint8_t form, int x, int y, int size) {
+    if (!spriteAtlasAttached_) attachSpriteAtlas();
+    SDL_Texture* tex = nullptr;
+    SDL_Rect src;
+    if (!spriteAtlas_.find(species, form, tex, src)) {
+        // Not packed: a loose PNG from spriteDir(), if there is one.
+        tex = sprites_.get(renderer_, species, form);
+        if (!tex) return;
+        src = {0, 0, 0, 0};
+        SDL_QueryTexture(tex, nullptr, nullptr, &src.w, &src.h);
     }
+    if (src.w <= 0 || src.h <= 0) return;
 
-    spriteCache_[key] = tex;
-    return tex;
+    float scale = std::min((float)size / src.w, (float)size / src.h);
+    int dstW = (int)(src.w * scale);
+    int dstH = (int)(src.h * scale);
+    SDL_Rect dst = {x + (size - dstW) / 2, y + (size - dstH) / 2, dstW, dstH};
+    SDL_RenderCopy(renderer_, tex, &src, &dst);
 }
 
 void UI::freeSprites() {
-    for (auto& [key, tex] : spriteCache_) {
-        if (tex) SDL_DestroyTexture(tex);
-    }
-    spriteCache_.clear();
+    sprites_.clear();
+    spriteAtlas_.free();
+    spriteAtlasAttached_ = false;
 }
 
 // --- Text data ---
 
 void UI::loadTextData(const std::string& dataDir) {
+    if (textReady_.valid()) {
+        textReady_.wait();
+        textReady_ = {};
+    }
     if (textDataLoaded_) return;
+    readTextData(dataDir);
+}
+
+// Runs on the loader thread when preloaded; touches only the name tables.
+void UI::readTextData(const std::string& dataDir) {
     speciesNames_ = TextData::loadLines(dataDir + "species_en.txt");
     moveNames_    = TextData::loadLines(dataDir + "moves_en.txt");
     natureNames_  = TextData::loadLines(dataDir + "natures_en.txt");
@@ -1,5 +1,6 @@
 #include "ui.h"
 #include "pla/pla_markers.h"
+#include "dmnt_mem.h"
 #include <switch.h>
 #include <algorithm>
 #include <cmath>
@@ -13,28 +14,66 @@ static const char* NATURE_NAMES[25] = {
     "Calm","Gentle","Sassy","Careful","Quirky"
 };
 
+// Shiny PID rolls for regular spawns by research progress. decorate() keeps a
+// table for every roll count per seed, so cycling these never re-searches.
+static const struct { int rolls; const char* label; } PLA_ROLL_PRESETS[] = {
+    {1, "Base"}, {2, "Research 10"}, {4, "Perfect"}, {7, "Perfect + Charm"},
+};
+static constexpr int PLA_ROLL_PRESET_COUNT =
+    (int)(sizeof(PLA_ROLL_PRESETS) / sizeof(PLA_ROLL_PRESETS[0]));
+
+// Hunt targets listed under "Next shinies:" in the detail popup, one
+// filtered search per spawner each (see plaHuntFilter).
+static const char* PLA_HUNT_LABELS[] = {"Next alpha:", "Next shiny alpha:", "Next 0 Atk:"};
+
+static PlaFilterSearch::Filter plaHuntFilter(int target) {
+    PlaFilterSearch::Filter f;
+    switch (target) {
+        case 0: f.alpha = 1; break;
+        case 1: f.alpha = 1; f.shiny = true; break;
+        case 2: f.ivMax[1] = 0; break;  // Atk
+    }
+    return f;
+}
+
+int UI::plaShinyRolls() const {
+    return PLA_ROLL_PRESETS[plaRollPreset_].rolls;
+}
+
+void UI::decoratePla() {
+    plaReader_.decorate((PlaRegion)plaTab_, plaShinyRolls());
+}
+
+void UI::updatePlaOutbreakPath() {
+    plaOutbreakPath_ = {};
+    if (!plaOutbreak_.present) return;
+    PlaOutbreakPath::Options opt;
+    opt.shinyRolls = plaShinyRolls() + PlaOutbreakPath::OUTBREAK_BONUS_ROLLS;
+    opt.threads = DEEP_SHINY_THREADS + 1;
+    plaOutbreakPath_ = PlaOutbreakPath::search(plaOutbreak_.groupSeed, plaOutbreak_.spawnCount, opt);
+}
+
 void UI::runPla(const std::string& basePath) {
     basePath_ = basePath;
     liveMode_ = true;
     selectedVersion_ = GameVersion::LegendsArceus;
 
     showWorking("Loading Hisui maps...");
-    std::string mapDir = "romfs:/maps/";
-    auto loadMap = [&](const char* name) -> SDL_Texture* {
-        std::string path = mapDir + name;
-        SDL_Surface* surf = IMG_Load(path.c_str());
-        if (!surf) return nullptr;
-        SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer_, surf);
-        SDL_FreeSurface(surf);
-        return tex;
-    };
     for (int r = 0; r < (int)PlaRegion::Count; r++) {
         if (!plaMaps_[r])
-            plaMaps_[r] = loadMap(plaRegionMapFile((PlaRegion)r));
+            plaMaps_[r] = loadMapTexture(plaRegionMapFile((PlaRegion)r));
     }
 
     showWorking("Scanning spawners...");
-    if (!plaReader_.readLive(256)) {
+    bool scanned;
+    {
+        // One session across both reads so the outbreak scan reuses the
+        // spawner base resolved by readLive().
+        DmntMem::Session session;
+        scanned = plaReader_.readLive(256);
+        if (scanned) plaOutbreak_ = plaReader_.readOutbreak();
+    }
+    if (!scanned) {
         showMessageAndWait("Error",
             "Failed to read spawner array.\n"
             "Make sure Pokemon Legends: Arceus\n"
@@ -42,13 +81,24 @@ void UI::runPla(const std::string& basePath) {
             "and dmnt:cht can attach.");
         return;
     }
-    plaOutbreak_ = plaReader_.readOutbreak();
+    plaReader_.setSearchThreads(DEEP_SHINY_THREADS + 1);
     plaTab_ = 0;
-    plaReader_.decorate((PlaRegion)plaTab_);
+    plaRouteTab_ = -1;
+    decoratePla();
+    updatePlaOutbreakPath();
+    startPlaDeepSearch();
     plaCursor_ = 0;
     plaScroll_ = 0;
     rebuildPlaFilteredList();
 
+    // From here on the watch thread owns memory reads.
+    plaWatch_.start(WATCH_INTERVAL_MS, [this](std::vector<PlaScan>& out) {
+        PlaScan scan;
+        if (!plaReader_.pollLive(scan, 256)) return false;
+        out.push_back(std::move(scan));
+        return true;
+    });
+
     dirty_ = true;
     bool running = true;
     while (running) {
@@ -67,6 +117,8 @@ void UI::runPla(const std::string& basePath) {
             handlePlaViewInput(running);
         }
         if (showAbout_ != aboutBefore) markDirty();
+        if (plaWatch_.take(plaScans_)) applyPlaScan();
+        if (takePlaDeepSearch()) markDirty();
 
         if (dirty_) {
             drawPlaViewFrame();
@@ -76,30 +128,141 @@ void UI::runPla(const std::string& basePath) {
         }
         SDL_Delay(16);
     }
+    plaWatch_.stop();
+    cancelPlaDeepSearch();
+}
+
+void UI::applyPlaScan() {
+    // Keep the cursor on the same group when it is still listed.
+    int selectedGroup = -1;
+    if (plaCursor_ < (int)plaFiltered_.size())
+        selectedGroup = plaReader_.spawners().groupId[plaFiltered_[plaCursor_]];
+
+    // Only the newest scan matters; decorate() reuses results for unchanged seeds.
+    PlaScan& scan = plaScans_.back();
+    if (!(scan.outbreak == plaOutbreak_)) {
+        plaOutbreak_ = scan.outbreak;
+        updatePlaOutbreakPath();
+    }
+    plaReader_.applyScan(std::move(scan));
+    decoratePla();
+    rebuildPlaFilteredList();
+
+    const auto& groupIds = plaReader_.spawners().groupId;
+    for (int fi = 0; fi < (int)plaFiltered_.size(); fi++) {
+        if (groupIds[plaFiltered_[fi]] == selectedGroup) {
+            plaCursor_ = fi;
+            break;
+        }
+    }
+    if (plaFiltered_.empty()) plaShowDetail_ = false;
+    startPlaDeepSearch();
+    markDirty();
+}
+
+void UI::startPlaDeepSearch() {
+    // A running search keeps going; its seeds are still wanted, and the next
+    // scan (or the one after it finishes) picks up anything it missed.
+    if (plaDeepJob_.valid()) return;
+
+    static_assert(sizeof(PLA_HUNT_LABELS) / sizeof(PLA_HUNT_LABELS[0]) == PLA_HUNT_TARGETS,
+                  "one label per hunt target");
+
+    if (plaDeepHits_.size() >= DEEP_SHINY_MAX) plaDeepHits_.clear();
+    std::vector<PlaShinySearch::Job> jobs;
+    const auto& sps = plaReader_.spawners();
+    for (uint64_t seed : sps.groupSeed) {
+        if (!plaDeepHits_.count(seed)) jobs.push_back({seed, plaShinyRolls()});
+    }
+    // Hunt targets depend on the marker's slot table, so only this tab's.
+    if (plaHuntTab_ != plaTab_ || plaHuntHits_.size() >= DEEP_SHINY_MAX) {
+        plaHuntHits_.clear();
+        plaHuntTab_ = plaTab_;
+    }
+    std::vector<PlaFilterSearch::Job> huntJobs;
+    for (size_t i = 0; i < sps.size(); i++) {
+        if (sps.region[i] != plaTab_ || plaHuntHits_.count(sps.groupSeed[i])) continue;
+        const auto* m = PlaMarkers::markerFor((PlaRegion)plaTab_, sps.groupId[i]);
+        if (m) huntJobs.push_back({sps.groupSeed[i], plaShinyRolls(), m->ivs, m});
+    }
+    if (jobs.empty() && huntJobs.empty()) return;
+
+    plaDeepCancel_ = false;
+    plaDeepJob_ = std::async(std::launch::async,
+                             [this, jobs = std::move(jobs), huntJobs = std::move(huntJobs),
+                              tab = plaTab_] {
+        ThreadUtil::moveToSpareCore(0);
+        std::vector<PlaShinySearch::Hits> hits(jobs.size());
+        PlaShinySearch::Options opt;
+        opt.maxAdvance = DEEP_SHINY_ADVANCES;
+        opt.firstK = DEEP_SHINY_HITS;
+        opt.threads = DEEP_SHINY_THREADS;
+        opt.cancel = &plaDeepCancel_;
+        PlaShinySearch::run(jobs.data(), jobs.size(), opt, hits.data());
+
+        std::vector<PlaHuntHits> hunt(huntJobs.size());
+        std::vector<int> advance(huntJobs.size());
+        PlaFilterSearch::Options huntOpt;
+        huntOpt.maxAdvance = DEEP_SHINY_ADVANCES;
+        huntOpt.threads = DEEP_SHINY_THREADS;
+        huntOpt.cancel = &plaDeepCancel_;
+        for (int t = 0; t < PLA_HUNT_TARGETS; t++) {
+            PlaFilterSearch::run(huntJobs.data(), huntJobs.size(), plaHuntFilter(t), huntOpt,
+                                 advance.data());
+            for (size_t i = 0; i < huntJobs.size(); i++) hunt[i].advance[t] = advance[i];
+        }
+
+        PlaDeepBatch out;
+        out.tab = tab;
+        if (!plaDeepCancel_) {
+            for (size_t i = 0; i < jobs.size(); i++) out.shiny[jobs[i].groupSeed] = hits[i];
+            for (size_t i = 0; i < huntJobs.size(); i++) out.hunt[huntJobs[i].groupSeed] = hunt[i];
+        }
+        return out;
+    });
+}
+
+void UI::cancelPlaDeepSearch() {
+    if (!plaDeepJob_.valid()) return;
+    plaDeepCancel_ = true;
+    plaDeepJob_.get();
+}
+
+bool UI::takePlaDeepSearch() {
+    if (!plaDeepJob_.valid() ||
+        plaDeepJob_.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return false;
+    PlaDeepBatch done = plaDeepJob_.get();
+    plaDeepHits_.insert(done.shiny.begin(), done.shiny.end());
+    if (done.tab == plaHuntTab_) plaHuntHits_.insert(done.hunt.begin(), done.hunt.end());
+    startPlaDeepSearch();  // seeds (or a tab) that arrived while it ran
+    return !done.shiny.empty() || !done.hunt.empty();
 }
 
 void UI::rebuildPlaFilteredList() {
     plaFiltered_.clear();
-    auto& sps = plaReader_.spawners();
+    const auto& sps = plaReader_.spawners();
     plaFiltered_.reserve(sps.size());
     for (int i = 0; i < (int)sps.size(); i++) {
-        const auto& s = sps[i];
-        if (s.region != plaTab_) continue;
+        if (sps.region[i] != plaTab_) continue;
         // Hide spawners without an overworld slot table - typically story/fixed
         // encounters (legendaries, lords, mission spawns) or unused placeholders.
         // They produce "Group N" rows with no species, not useful for shiny hunting.
-        if (s.speciesId == 0) continue;
-        if (plaShinyOnly_ && !(s.shinyAdvance == 0 && s.firstSpawn.shiny)) continue;
+        if (sps.speciesId[i] == 0) continue;
+        if (plaShinyOnly_ && !sps.shinyNow(i)) continue;
         plaFiltered_.push_back(i);
     }
     // Sort by shiny advance ASC: 0 (current) first, then 1..N, then -1 (no shiny) last.
-    std::sort(plaFiltered_.begin(), plaFiltered_.end(), [&sps](int a, int b) {
-        int sa = sps[a].shinyAdvance, sb = sps[b].shinyAdvance;
+    const auto& adv = sps.shinyAdvance;
+    const auto& gid = sps.groupId;
+    std::sort(plaFiltered_.begin(), plaFiltered_.end(), [&adv, &gid](int a, int b) {
+        int sa = adv[a], sb = adv[b];
         bool ua = (sa < 0), ub = (sb < 0);
         if (ua != ub) return !ua;               // unknowns sink
         if (!ua && sa != sb) return sa < sb;    // ascending among knowns
-        return sps[a].groupId < sps[b].groupId; // stable by group_id
+        return gid[a] < gid[b];                 // stable by group_id
     });
+    if (plaRouteMode_) orderPlaByRoute();
     if (plaCursor_ >= (int)plaFiltered_.size())
         plaCursor_ = std::max(0, (int)plaFiltered_.size() - 1);
     if (plaScroll_ > plaCursor_) plaScroll_ = plaCursor_;
@@ -114,8 +277,7 @@ void UI::drawPlaViewFrame() {
              gameDisplayNameOf(selectedVersion_));
     drawText(title, 10, 10, COLOR_TERA, font_);
 
-    int tw, th;
-    TTF_SizeUTF8(font_, "Live Mode", &tw, &th);
+    int tw = glyphs_.measure(font_, "Live Mode");
     drawText("Live Mode", (SCREEN_W - tw) / 2, 10, COLOR_SHINY, font_);
 
     drawPlaMapPanel();
@@ -123,11 +285,11 @@ void UI::drawPlaViewFrame() {
 
     if (plaShowDetail_ && !plaFiltered_.empty()) {
         int idx = plaFiltered_[plaCursor_];
-        drawPlaDetailPopup(plaReader_.spawners()[idx]);
+        drawPlaDetailPopup(plaReader_.detail(idx));
     }
 
     drawStatusBar(
-        "D-Pad: Nav  ZL/ZR: Page  A: Detail  Y: Shiny-only  L/R: Region  -: About  +: Quit",
+        "D-Pad: Nav  ZL/ZR: Page  A: Detail  X: Rolls  Y: Shiny-only  R3: Route  L/R: Region  -: About  +: Quit",
         "Live Mode - Pokemon Legends: Arceus");
 }
 
@@ -152,6 +314,39 @@ void UI::drawPlaMapTabs(int x, int y, int w) {
     }
 }
 
+// Spawners further than this from a shiny are left off the route.
+static constexpr int PLA_ROUTE_MAX_ADVANCE = 100;
+
+void UI::orderPlaByRoute() {
+    const auto& sps = plaReader_.spawners();
+    std::vector<PlaRoutePlanner::Stop> stops;
+    for (int i : plaFiltered_) {
+        int adv = sps.shinyAdvance[i];
+        if (adv >= 0 && adv <= PLA_ROUTE_MAX_ADVANCE)
+            stops.push_back({sps.groupId[i], sps.markerX[i], sps.markerZ[i], adv});
+    }
+    // New region: plan from the spawner closest to shiny (the list head).
+    // Otherwise patch the existing route for whatever was consumed or added.
+    if (plaRouteTab_ != plaTab_) {
+        plaRouteTab_ = plaTab_;
+        float sx = stops.empty() ? 0.0f : stops[0].x;
+        float sz = stops.empty() ? 0.0f : stops[0].z;
+        plaRoute_.plan(stops, sx, sz);
+    } else {
+        plaRoute_.update(stops);
+    }
+
+    // Route stops first in visiting order, everything else after as before.
+    std::unordered_map<int, int> rank;
+    auto route = plaRoute_.route();
+    for (int r = 0; r < (int)route.size(); r++) rank[route[r].id] = r;
+    std::stable_sort(plaFiltered_.begin(), plaFiltered_.end(), [&](int a, int b) {
+        auto ra = rank.find(sps.groupId[a]), rb = rank.find(sps.groupId[b]);
+        if ((ra == rank.end()) != (rb == rank.end())) return rb == rank.end();
+        return ra != rank.end() && ra->second < rb->second;
+    });
+}
+
 void UI::drawPlaMapPanel() {
     drawRect(MAP_PANEL_X, MAP_PANEL_Y, MAP_PANEL_W, MAP_PANEL_H, COLOR_PANEL_BG);
     drawPlaMapTabs(MAP_PANEL_X, MAP_PANEL_Y, MAP_PANEL_W);
@@ -192,24 +387,35 @@ void UI::drawPlaMapPanel() {
     if (wx < 1.0f) wx = 1.0f;
     if (wz < 1.0f) wz = 1.0f;
 
-    auto& sps = plaReader_.spawners();
+    if (plaRouteMode_) {
+        auto route = plaRoute_.route();
+        SDL_SetRenderDrawColor(renderer_, COLOR_SHINY.r, COLOR_SHINY.g, COLOR_SHINY.b, 200);
+        for (size_t i = 1; i < route.size(); i++) {
+            SDL_RenderDrawLine(renderer_,
+                mapX + (int)((route[i - 1].x - b.minX) / wx * mapW),
+                mapY + (int)((route[i - 1].z - b.minZ) / wz * mapH),
+                mapX + (int)((route[i].x - b.minX) / wx * mapW),
+                mapY + (int)((route[i].z - b.minZ) / wz * mapH));
+        }
+    }
+
+    const auto& sps = plaReader_.spawners();
     for (int fi = 0; fi < (int)plaFiltered_.size(); fi++) {
         int idx = plaFiltered_[fi];
-        const auto& s = sps[idx];
-        if (s.region != plaTab_) continue;
-        float u = (s.markerX - b.minX) / wx;
-        float v = (s.markerZ - b.minZ) / wz;
+        if (sps.region[idx] != plaTab_) continue;
+        float u = (sps.markerX[idx] - b.minX) / wx;
+        float v = (sps.markerZ[idx] - b.minZ) / wz;
         int sx = mapX + (int)(u * mapW);
         int sy = mapY + (int)(v * mapH);
         if (sx < mapX || sx > mapX + mapW || sy < mapY || sy > mapY + mapH) continue;
 
-        bool currentShiny = (s.shinyAdvance == 0 && s.firstSpawn.shiny);
+        bool currentShiny = sps.shinyNow(idx);
         bool selected = (fi == plaCursor_);
         int radius = selected ? 7 : 5;
 
         SDL_Color dot = COLOR_MAP_DOT;
-        if (currentShiny)     dot = COLOR_SHINY;
-        else if (!s.active)   dot = {90, 90, 100, 255};
+        if (currentShiny)            dot = COLOR_SHINY;
+        else if (!sps.active(idx))   dot = {90, 90, 100, 255};
         fillCircle(sx, sy, radius, dot);
 
         if (selected) {
@@ -228,30 +434,44 @@ void UI::drawPlaMapPanel() {
 
     // Mini outbreak badge in the bottom-left of the map area
     if (plaOutbreak_.present) {
-        int bx = mapX + 8, by = mapY + mapH - 28;
-        drawRect(bx, by, 200, 22, {40, 40, 60, 220});
+        int bx = mapX + 8, by = mapY + mapH - 50;
+        drawRect(bx, by, 260, 44, {40, 40, 60, 220});
         char buf[64];
         snprintf(buf, sizeof(buf), "Outbreak: grp %d x%u",
                  plaOutbreak_.groupId, (unsigned)plaOutbreak_.spawnCount);
         drawText(buf, bx + 6, by + 3, COLOR_SHINY, fontSmall_);
+
+        // Shortest clear-k path to a shiny, e.g. "Shiny: clear 2-1-3"
+        const auto& path = plaOutbreakPath_;
+        if (!path.found) {
+            snprintf(buf, sizeof(buf), "No shiny path");
+        } else if (path.actions == 0) {
+            snprintf(buf, sizeof(buf), "Shiny: initial spawn %d", path.spawnIndex + 1);
+        } else {
+            int n = snprintf(buf, sizeof(buf), "Shiny: clear ");
+            for (int i = 0; i < path.actions; i++)
+                n += snprintf(buf + n, sizeof(buf) - n, "%s%u", i ? "-" : "",
+                              (unsigned)path.path[i]);
+        }
+        drawText(buf, bx + 6, by + 23, path.found ? COLOR_SHINY : COLOR_TEXT_DIM, fontSmall_);
     }
 }
 
 void UI::drawPlaListPanel() {
     drawRect(LIST_PANEL_X, LIST_PANEL_Y, LIST_PANEL_W, LIST_PANEL_H, COLOR_PANEL_BG);
 
-    auto& sps = plaReader_.spawners();
+    const auto& sps = plaReader_.spawners();
     int count = (int)plaFiltered_.size();
 
     int activeCount = 0, shinyCount = 0;
     for (int fi : plaFiltered_) {
-        const auto& s = sps[fi];
-        if (s.active) activeCount++;
-        if (s.shinyAdvance == 0 && s.firstSpawn.shiny) shinyCount++;
+        if (sps.active(fi)) activeCount++;
+        if (sps.shinyNow(fi)) shinyCount++;
     }
     char header[128];
-    snprintf(header, sizeof(header), "%s: %d  (%d active, %d shiny)",
-             plaRegionName((PlaRegion)plaTab_), count, activeCount, shinyCount);
+    snprintf(header, sizeof(header), "%s: %d  (%d active, %d shiny)  %s",
+             plaRegionName((PlaRegion)plaTab_), count, activeCount, shinyCount,
+             PLA_ROLL_PRESETS[plaRollPreset_].label);
     drawText(header, LIST_PANEL_X + 10, LIST_PANEL_Y + 5, COLOR_TEXT, fontSmall_);
 
     int listY = LIST_PANEL_Y + 28;
@@ -268,7 +488,7 @@ void UI::drawPlaListPanel() {
         int idx = plaFiltered_[fi];
         int rowY = listY + vi * rowH;
         drawPlaRow(LIST_PANEL_X + 5, rowY, LIST_PANEL_W - 10,
-                   sps[idx], fi == plaCursor_, rowH);
+                   plaReader_.detail(idx), fi == plaCursor_, rowH);
     }
 
     if (count > visibleRows) {
@@ -305,18 +525,8 @@ void UI::drawPlaRow(int x, int y, int w, const PlaSpawner& s, bool selected, int
     int spriteSize = std::min(LIST_SPRITE_SIZE, rh - 4);
     int spriteX = x + 4;
     int spriteY = y + (rh - spriteSize) / 2;
-    if (s.speciesId > 0) {
-        if (SDL_Texture* sprite = getSprite(s.speciesId, s.form)) {
-            int texW, texH;
-            SDL_QueryTexture(sprite, nullptr, nullptr, &texW, &texH);
-            float scale = std::min((float)spriteSize / texW, (float)spriteSize / texH);
-            int dstW = (int)(texW * scale);
-            int dstH = (int)(texH * scale);
-            SDL_Rect dst = {spriteX + (spriteSize - dstW) / 2,
-                            spriteY + (spriteSize - dstH) / 2, dstW, dstH};
-            SDL_RenderCopy(renderer_, sprite, nullptr, &dst);
-        }
-    }
+    if (s.speciesId > 0)
+        drawSprite(s.speciesId, s.form, spriteX, spriteY, spriteSize);
     int textX = x + spriteSize + 12;
 
     char buf[128];
@@ -357,7 +567,7 @@ void UI::drawPlaRow(int x, int y, int w, const PlaSpawner& s, bool selected, int
 }
 
 void UI::drawPlaDetailPopup(const PlaSpawner& s) {
-    constexpr int POP_W = 580, POP_H = 420;
+    constexpr int POP_W = 580, POP_H = 516;
     int px = (SCREEN_W - POP_W) / 2;
     int py = (SCREEN_H - POP_H) / 2;
 
@@ -374,19 +584,8 @@ void UI::drawPlaDetailPopup(const PlaSpawner& s) {
 
     // Sprite top-left
     constexpr int DETAIL_SPRITE_SIZE = 80;
-    if (s.speciesId > 0) {
-        if (SDL_Texture* sprite = getSprite(s.speciesId, s.form)) {
-            int texW, texH;
-            SDL_QueryTexture(sprite, nullptr, nullptr, &texW, &texH);
-            float scale = std::min((float)DETAIL_SPRITE_SIZE / texW,
-                                   (float)DETAIL_SPRITE_SIZE / texH);
-            int dstW = (int)(texW * scale);
-            int dstH = (int)(texH * scale);
-            SDL_Rect dst = {lx + (DETAIL_SPRITE_SIZE - dstW) / 2,
-                            y + (DETAIL_SPRITE_SIZE - dstH) / 2, dstW, dstH};
-            SDL_RenderCopy(renderer_, sprite, nullptr, &dst);
-        }
-    }
+    if (s.speciesId > 0)
+        drawSprite(s.speciesId, s.form, lx, y, DETAIL_SPRITE_SIZE);
     int titleX = lx + DETAIL_SPRITE_SIZE + 12;
 
     char buf[128];
@@ -456,6 +655,42 @@ void UI::drawPlaDetailPopup(const PlaSpawner& s) {
     } else {
         drawText("None within 5000", lx + 170, y, COLOR_TEXT_DIM, fontSmall_);
     }
+    y += lh;
+
+    drawText("Next shinies:", lx, y, COLOR_TEXT_DIM, fontSmall_);
+    auto deep = plaDeepHits_.find(s.groupSeed);
+    if (deep == plaDeepHits_.end()) {
+        drawText("Searching...", lx + 170, y, COLOR_TEXT_DIM, fontSmall_);
+    } else if (deep->second.count == 0) {
+        snprintf(buf, sizeof(buf), "None within %u", DEEP_SHINY_ADVANCES);
+        drawText(buf, lx + 170, y, COLOR_TEXT_DIM, fontSmall_);
+    } else {
+        int n = 0;
+        for (int i = 0; i < deep->second.count; i++)
+            n += snprintf(buf + n, sizeof(buf) - n, "%s%u", i ? ", " : "",
+                          deep->second.advance[i]);
+        drawText(buf, lx + 170, y, COLOR_SHINY, fontSmall_);
+    }
+    y += lh;
+
+    auto hunt = plaHuntHits_.find(s.groupSeed);
+    bool huntReady = plaHuntTab_ == plaTab_ && hunt != plaHuntHits_.end();
+    for (int t = 0; t < PLA_HUNT_TARGETS; t++) {
+        drawText(PLA_HUNT_LABELS[t], lx, y, COLOR_TEXT_DIM, fontSmall_);
+        int adv = huntReady ? hunt->second.advance[t] : -1;
+        if (!huntReady) {
+            drawText("Searching...", lx + 170, y, COLOR_TEXT_DIM, fontSmall_);
+        } else if (adv < 0) {
+            snprintf(buf, sizeof(buf), "None within %u", DEEP_SHINY_ADVANCES);
+            drawText(buf, lx + 170, y, COLOR_TEXT_DIM, fontSmall_);
+        } else if (adv == 0) {
+            drawText("Current (advance 0)", lx + 170, y, COLOR_TEXT, fontSmall_);
+        } else {
+            snprintf(buf, sizeof(buf), "in %d advance%s", adv, adv == 1 ? "" : "s");
+            drawText(buf, lx + 170, y, COLOR_TEXT, fontSmall_);
+        }
+        y += lh;
+    }
 
     drawTextRight("B: Close", px + POP_W - 20, py + POP_H - 35, COLOR_TEXT_DIM, fontSmall_);
 }
@@ -497,15 +732,35 @@ void UI::handlePlaViewInput(bool& running) {
                     plaCursor_ = 0; plaScroll_ = 0;
                     rebuildPlaFilteredList();
                     break;
+                case SDL_CONTROLLER_BUTTON_Y: // Switch X = cycle shiny rolls
+                    plaRollPreset_ = (plaRollPreset_ + 1) % PLA_ROLL_PRESET_COUNT;
+                    decoratePla();
+                    updatePlaOutbreakPath();
+                    plaCursor_ = 0; plaScroll_ = 0;
+                    rebuildPlaFilteredList();
+                    // Deep results are per roll count; search again.
+                    cancelPlaDeepSearch();
+                    plaDeepHits_.clear();
+                    plaHuntHits_.clear();
+                    startPlaDeepSearch();
+                    break;
                 case SDL_CONTROLLER_BUTTON_LEFTSHOULDER:
                     plaTab_ = (plaTab_ + (int)PlaRegion::Count - 1) % (int)PlaRegion::Count;
-                    plaReader_.decorate((PlaRegion)plaTab_);
+                    decoratePla();
+                    startPlaDeepSearch();
                     plaCursor_ = 0; plaScroll_ = 0;
                     rebuildPlaFilteredList();
                     break;
                 case SDL_CONTROLLER_BUTTON_RIGHTSHOULDER:
                     plaTab_ = (plaTab_ + 1) % (int)PlaRegion::Count;
-                    plaReader_.decorate((PlaRegion)plaTab_);
+                    decoratePla();
+                    startPlaDeepSearch();
+                    plaCursor_ = 0; plaScroll_ = 0;
+                    rebuildPlaFilteredList();
+                    break;
+                case SDL_CONTROLLER_BUTTON_RIGHTSTICK:
+                    plaRouteMode_ = !plaRouteMode_;
+                    plaRouteTab_ = -1;
                     plaCursor_ = 0; plaScroll_ = 0;
                     rebuildPlaFilteredList();
                     break;
@@ -5,11 +5,6 @@
 
 // --- SV Raid View ---
 
-// Rare item IDs: Herba Mystica, Ability Patch, Ability Capsule, Bottle Cap, Gold Bottle Cap
-static bool isRareItem(uint16_t id) {
-    return (id >= 1904 && id <= 1908) || id == 1606 || id == 645 || id == 795 || id == 796;
-}
-
 void UI::rebuildFilteredList() {
     filteredIndices_.clear();
     auto& raids = reader_.raids();
@@ -31,7 +26,7 @@ void UI::rebuildFilteredList() {
             case SvFilterPreset::RareDrops: {
                 bool hasRare = false;
                 for (auto& r : raids[i].rewards) {
-                    if (isRareItem(r.itemId)) { hasRare = true; break; }
+                    if (RewardCalc::isRareItem(r.itemId)) { hasRare = true; break; }
                 }
                 if (!hasRare) continue;
                 break;
@@ -45,6 +40,26 @@ void UI::rebuildFilteredList() {
         raidCursor_ = std::max(0, (int)filteredIndices_.size() - 1);
 }
 
+void UI::applyRaidPatches() {
+    // Keep the cursor on the same raid slot across the rebuild when it survives.
+    int selectedSlot = -1;
+    if (raidCursor_ < (int)filteredIndices_.size())
+        selectedSlot = reader_.raids()[filteredIndices_[raidCursor_]].slotIndex;
+
+    reader_.applyPatches(raidPatches_);
+    rebuildFilteredList();
+
+    auto& raids = reader_.raids();
+    for (int fi = 0; fi < (int)filteredIndices_.size(); fi++) {
+        if (raids[filteredIndices_[fi]].slotIndex == selectedSlot) {
+            raidCursor_ = fi;
+            break;
+        }
+    }
+    if (filteredIndices_.empty()) showDetail_ = false;
+    markDirty();
+}
+
 // worldToScreen is handled inline in drawMapPanel using dynamic bounds from filtered raids
 
 void UI::drawMapPanel() {
@@ -234,8 +249,7 @@ void UI::drawListPanel() {
             snprintf(filterBuf, sizeof(filterBuf), "[Shiny]");
         else
             snprintf(filterBuf, sizeof(filterBuf), "%s", presetStr);
-        int tw = 0, th = 0;
-        TTF_SizeUTF8(fontSmall_, filterBuf, &tw, &th);
+        int tw = glyphs_.measure(fontSmall_, filterBuf);
         int fx = LIST_PANEL_X + (LIST_PANEL_W - tw) / 2;
         drawText(filterBuf, fx, headerY, COLOR_SHINY, fontSmall_);
     }
@@ -315,17 +329,7 @@ void UI::drawRaidRow(int x, int y, int w, const RaidInfo& raid, bool selected, i
     int spriteSize = std::min(LIST_SPRITE_SIZE, rh - 4);
     int spriteX = x + 4;
     int spriteY = y + (rh - spriteSize) / 2;
-    SDL_Texture* sprite = getSprite(raid.details.species);
-    if (sprite) {
-        int texW, texH;
-        SDL_QueryTexture(sprite, nullptr, nullptr, &texW, &texH);
-        float scale = std::min((float)spriteSize / texW, (float)spriteSize / texH);
-        int dstW = (int)(texW * scale);
-        int dstH = (int)(texH * scale);
-        SDL_Rect dst = {spriteX + (spriteSize - dstW) / 2,
-                        spriteY + (spriteSize - dstH) / 2, dstW, dstH};
-        SDL_RenderCopy(renderer_, sprite, nullptr, &dst);
-    }
+    drawSprite(raid.details.species, 0, spriteX, spriteY, spriteSize);
 
     int textX = x + spriteSize + 12;
 
@@ -401,8 +405,7 @@ void UI::drawRaidViewFrame() {
     drawText(title, 10, 10, COLOR_TERA, font_);
 
     if (liveMode_) {
-        int tw, th;
-        TTF_SizeUTF8(font_, "Live Mode", &tw, &th);
+        int tw = glyphs_.measure(font_, "Live Mode");
         drawText("Live Mode", (SCREEN_W - tw) / 2, 10, COLOR_SHINY, font_);
     }
 
@@ -455,17 +458,7 @@ void UI::drawDetailPopup(const RaidInfo& raid) {
 
     // Sprite in top-left (fit to box, preserve aspect ratio)
     constexpr int DETAIL_SPRITE_SIZE = 80;
-    SDL_Texture* sprite = getSprite(raid.details.species);
-    if (sprite) {
-        int texW, texH;
-        SDL_QueryTexture(sprite, nullptr, nullptr, &texW, &texH);
-        float scale = std::min((float)DETAIL_SPRITE_SIZE / texW, (float)DETAIL_SPRITE_SIZE / texH);
-        int dstW = (int)(texW * scale);
-        int dstH = (int)(texH * scale);
-        SDL_Rect dst = {lx + (DETAIL_SPRITE_SIZE - dstW) / 2,
-                        y + (DETAIL_SPRITE_SIZE - dstH) / 2, dstW, dstH};
-        SDL_RenderCopy(renderer_, sprite, nullptr, &dst);
-    }
+    drawSprite(raid.details.species, 0, lx, y, DETAIL_SPRITE_SIZE);
 
     // Title: species name + form (next to sprite)
     int titleX = lx + DETAIL_SPRITE_SIZE + 12;
@@ -590,7 +583,7 @@ void UI::drawDetailPopup(const RaidInfo& raid) {
     std::vector<DisplayItem> sharedItems, hostItems, joinerItems;
     for (auto& a : aggRewards) {
         const std::string& itemName = getItemName(a.id);
-        bool rare = isRareItem(a.id);
+        bool rare = RewardCalc::isRareItem(a.id);
         auto fmtItem = [&](char* buf, int amount) {
             if (amount > 1)
                 snprintf(buf, 64, "%s x%d", itemName.c_str(), amount);
@@ -16,29 +16,13 @@ void UI::runSwSh(const std::string& basePath, GameVersion game) {
 
     showWorking("Loading resources...");
 
-#ifdef __SWITCH__
-    std::string dataDir = "romfs:/data/";
-    std::string mapDir  = "romfs:/maps/";
-#else
-    std::string dataDir = "romfs/data/";
-    std::string mapDir  = "romfs/maps/";
-#endif
-
-    loadTextData(dataDir);
-    personal_.load(dataDir + "personal_sv");
+    loadTextData(dataDir());
+    loadPersonal();
 
     // Load SwSh map images
-    auto loadMap = [&](const char* name) -> SDL_Texture* {
-        std::string path = mapDir + name;
-        SDL_Surface* surf = IMG_Load(path.c_str());
-        if (!surf) return nullptr;
-        SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer_, surf);
-        SDL_FreeSurface(surf);
-        return tex;
-    };
-    if (!mapWildArea_) mapWildArea_ = loadMap("wild_area.png");
-    if (!mapIoA_) mapIoA_ = loadMap("isle_of_armor.png");
-    if (!mapCT_) mapCT_ = loadMap("crown_tundra.png");
+    if (!mapWildArea_) mapWildArea_ = loadMapTexture("wild_area.png");
+    if (!mapIoA_) mapIoA_ = loadMapTexture("isle_of_armor.png");
+    if (!mapCT_) mapCT_ = loadMapTexture("crown_tundra.png");
 
     showWorking("Reading den data from memory...");
 
@@ -46,6 +30,7 @@ void UI::runSwSh(const std::string& basePath, GameVersion game) {
         showMessageAndWait("Error", "Failed to read den data from game memory.");
         return;
     }
+    denCrawler_.predictAll();
 
     swshTab_ = 0;
     swshCursor_ = 0;
@@ -54,6 +39,11 @@ void UI::runSwSh(const std::string& basePath, GameVersion game) {
     swshShowAll_ = false;
     rebuildSwShFilteredList();
 
+    // From here on the watch thread owns memory reads.
+    denWatch_.start(WATCH_INTERVAL_MS, [this](std::vector<DenPatch>& out) {
+        return denCrawler_.pollLive(out);
+    });
+
     dirty_ = true;
     bool running = true;
     while (running) {
@@ -74,6 +64,7 @@ void UI::runSwSh(const std::string& basePath, GameVersion game) {
         }
 
         if (showAbout_ != aboutBefore) markDirty();
+        if (denWatch_.take(denPatches_)) applyDenPatches();
 
         if (dirty_) {
             drawSwShViewFrame();
@@ -83,6 +74,24 @@ void UI::runSwSh(const std::string& basePath, GameVersion game) {
         }
         SDL_Delay(16);
     }
+    denWatch_.stop();
+}
+
+void UI::applyDenPatches() {
+    // Keep the cursor on the same den when it is still listed.
+    int selectedDen = swshCursor_ < (int)swshFiltered_.size() ? swshFiltered_[swshCursor_] : -1;
+
+    denCrawler_.applyPatches(denPatches_);
+    rebuildSwShFilteredList();
+
+    for (int fi = 0; fi < (int)swshFiltered_.size(); fi++) {
+        if (swshFiltered_[fi] == selectedDen) {
+            swshCursor_ = fi;
+            break;
+        }
+    }
+    if (swshFiltered_.empty()) swshShowDetail_ = false;
+    markDirty();
 }
 
 void UI::rebuildSwShFilteredList() {
@@ -124,8 +133,7 @@ void UI::drawSwShViewFrame() {
     drawText(title, 10, 10, COLOR_TERA, font_);
 
     if (liveMode_) {
-        int tw, th;
-        TTF_SizeUTF8(font_, "Live Mode", &tw, &th);
+        int tw = glyphs_.measure(font_, "Live Mode");
         drawText("Live Mode", (SCREEN_W - tw) / 2, 10, COLOR_SHINY, font_);
     }
 
@@ -354,19 +362,8 @@ void UI::drawSwShRow(int x, int y, int w, const SwShDenInfo& den, bool selected,
     int spriteX = x + 4;
     int spriteY = y + (rh - spriteSize) / 2;
 
-    if (den.species > 0) {
-        SDL_Texture* sprite = getSprite(den.species);
-        if (sprite) {
-            int texW, texH;
-            SDL_QueryTexture(sprite, nullptr, nullptr, &texW, &texH);
-            float scale = std::min((float)spriteSize / texW, (float)spriteSize / texH);
-            int dstW = (int)(texW * scale);
-            int dstH = (int)(texH * scale);
-            SDL_Rect dst = {spriteX + (spriteSize - dstW) / 2,
-                            spriteY + (spriteSize - dstH) / 2, dstW, dstH};
-            SDL_RenderCopy(renderer_, sprite, nullptr, &dst);
-        }
-    }
+    if (den.species > 0)
+        drawSprite(den.species, 0, spriteX, spriteY, spriteSize);
 
     int textX = x + spriteSize + 12;
 
@@ -417,11 +414,9 @@ void UI::drawSwShRow(int x, int y, int w, const SwShDenInfo& den, bool selected,
         std::string t1Name = getTypeName(t1);
         drawText(t1Name, textX + COL_TYPES, line1Y, t1Col, font_);
         if (t2 != t1) {
-            int tw1, th1;
-            TTF_SizeUTF8(font_, t1Name.c_str(), &tw1, &th1);
+            int tw1 = glyphs_.measure(font_, t1Name);
             drawText(" / ", textX + COL_TYPES + tw1, line1Y, textDim, font_);
-            int twSlash, thSlash;
-            TTF_SizeUTF8(font_, " / ", &twSlash, &thSlash);
+            int twSlash = glyphs_.measure(font_, " / ");
             SDL_Color t2Col = isCurrentlyShiny ? SDL_Color{50, 30, 10, 255} : getTypeColor(t2);
             drawText(getTypeName(t2), textX + COL_TYPES + tw1 + twSlash, line1Y, t2Col, font_);
         }
@@ -432,9 +427,7 @@ void UI::drawSwShRow(int x, int y, int w, const SwShDenInfo& den, bool selected,
         int tagX = x + w - 8;
         if (isCurrentlyShiny) {
             drawTextRight("Shiny!", tagX, line1Y, SDL_Color{120, 40, 0, 255}, font_);
-            int tw0, th0;
-            TTF_SizeUTF8(font_, "Shiny!", &tw0, &th0);
-            tagX -= tw0 + 8;
+            tagX -= glyphs_.measure(font_, "Shiny!") + 8;
         }
         if (den.isRare) {
             drawTextRight("Rare", tagX, line1Y, SDL_Color{200, 120, 255, 255}, font_);
@@ -496,20 +489,8 @@ void UI::drawSwShDetailPopup(const SwShDenInfo& den) {
 
     // Sprite
     constexpr int DETAIL_SPRITE_SIZE = 80;
-    if (den.species > 0) {
-        SDL_Texture* sprite = getSprite(den.species);
-        if (sprite) {
-            int texW, texH;
-            SDL_QueryTexture(sprite, nullptr, nullptr, &texW, &texH);
-            float scale = std::min((float)DETAIL_SPRITE_SIZE / texW,
-                                   (float)DETAIL_SPRITE_SIZE / texH);
-            int dstW = (int)(texW * scale);
-            int dstH = (int)(texH * scale);
-            SDL_Rect dst = {lx + (DETAIL_SPRITE_SIZE - dstW) / 2,
-                            y + (DETAIL_SPRITE_SIZE - dstH) / 2, dstW, dstH};
-            SDL_RenderCopy(renderer_, sprite, nullptr, &dst);
-        }
-    }
+    if (den.species > 0)
+        drawSprite(den.species, 0, lx, y, DETAIL_SPRITE_SIZE);
 
     // Species name next to sprite
     int titleX = lx + DETAIL_SPRITE_SIZE + 12;
@@ -561,11 +542,9 @@ void UI::drawSwShDetailPopup(const SwShDenInfo& den) {
         std::string t1Name = getTypeName(t1);
         drawText(t1Name, lx + 85, ly, getTypeColor(t1), fontSmall_);
         if (t2 != t1) {
-            int tw1, th1;
-            TTF_SizeUTF8(fontSmall_, t1Name.c_str(), &tw1, &th1);
+            int tw1 = glyphs_.measure(fontSmall_, t1Name);
             drawText(" / ", lx + 85 + tw1, ly, COLOR_TEXT_DIM, fontSmall_);
-            int twSlash, thSlash;
-            TTF_SizeUTF8(fontSmall_, " / ", &twSlash, &thSlash);
+            int twSlash = glyphs_.measure(fontSmall_, " / ");
             drawText(getTypeName(t2), lx + 85 + tw1 + twSlash, ly, getTypeColor(t2), fontSmall_);
         }
         ly += lineH;
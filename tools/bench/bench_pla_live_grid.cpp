@@ -0,0 +1,77 @@
+// Host benchmark for PlaLiveGrid: marker activity checks through the grid vs.
+// a brute-force nearest search over every live position.
+//
+// Uses the worst case the reader sees - a full live-position list and every
+// region's markers - with positions spread over a 1024x1024 map.
+//
+// Build and run from the repo root:
+//   g++ -std=c++20 -O2 -Iinclude -o bench_pla_live_grid
+//       tools/bench/bench_pla_live_grid.cpp source/pla/pla_live_grid.cpp
+//   ./bench_pla_live_grid
+#include "pla/pla_live_grid.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr size_t POSITIONS = PlaConfig::MAX_POSITIONS;
+constexpr size_t MARKERS   = 408 * 5;    // group ids per region x regions
+constexpr float  MAP_SIZE  = 1024.0f;
+constexpr float  RADIUS    = 25.0f;      // PlaReader's ACTIVE_RADIUS, also its cell size
+
+using Clock = std::chrono::steady_clock;
+
+long long micros(Clock::time_point a, Clock::time_point b) {
+    return (long long)std::chrono::duration_cast<std::chrono::microseconds>(b - a).count();
+}
+
+const PlaLivePos* bruteNearest(const std::vector<PlaLivePos>& pos, float x, float z) {
+    const PlaLivePos* best = nullptr;
+    float bestDist = RADIUS * RADIUS;
+    for (const PlaLivePos& p : pos) {
+        float dx = p.x - x, dz = p.z - z, d2 = dx * dx + dz * dz;
+        if (d2 <= bestDist) {
+            bestDist = d2;
+            best = &p;
+        }
+    }
+    return best;
+}
+
+} // anonymous
+
+int main() {
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> coord(0.0f, MAP_SIZE);
+    std::vector<PlaLivePos> pos(POSITIONS);
+    for (PlaLivePos& p : pos) p = {coord(rng), 50.0f, coord(rng)};
+    std::vector<PlaLivePos> markers(MARKERS);
+    for (PlaLivePos& m : markers) m = {coord(rng), 0.0f, coord(rng)};
+
+    static PlaLiveGrid grid;
+    std::vector<const PlaLivePos*> viaGrid(MARKERS), viaBrute(MARKERS);
+
+    auto t0 = Clock::now();
+    grid.build(pos.data(), pos.size(), RADIUS);
+    auto t1 = Clock::now();
+    for (size_t i = 0; i < MARKERS; i++)
+        viaGrid[i] = grid.nearest(markers[i].x, markers[i].z, RADIUS);
+    auto t2 = Clock::now();
+    for (size_t i = 0; i < MARKERS; i++)
+        viaBrute[i] = bruteNearest(pos, markers[i].x, markers[i].z);
+    auto t3 = Clock::now();
+
+    size_t hits = 0, mismatches = 0;
+    for (size_t i = 0; i < MARKERS; i++) {
+        hits += viaGrid[i] != nullptr;
+        mismatches += viaGrid[i] != viaBrute[i];
+    }
+    std::printf("%zu positions, %zu markers, %zu active\n", POSITIONS, MARKERS, hits);
+    std::printf("grid build   %lld us\n", micros(t0, t1));
+    std::printf("grid queries %lld us\n", micros(t1, t2));
+    std::printf("full scan    %lld us\n", micros(t2, t3));
+    std::printf("mismatches   %zu\n", mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
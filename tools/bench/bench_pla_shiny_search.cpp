@@ -0,0 +1,189 @@
+// Host benchmark for PlaShinySearch: the batch engine vs. one
+// PlaEncounter::nextShiny call per seed, and the deep first-K search.
+//
+// Sections:
+//   - first shiny within 5000 advances for 3000 seeds (1 and 3 rolls), engine
+//     vs. nextShiny, every result compared;
+//   - first 3 shinies within 1,000,000 advances for 300 seeds on 1 and
+//     `threads` threads, the first 20 checked against a full-generation walk;
+//   - the engine's per-advance work interleaved across 1/4/8 lockstep seeds,
+//     without the engine's lane bookkeeping, to show what interleaving alone
+//     buys on this CPU (the engine walks PlaShinySearch's LANES seeds).
+//
+// Build and run from the repo root:
+//   g++ -std=c++20 -O2 -pthread -Iinclude -o bench_pla_shiny_search
+//       tools/bench/bench_pla_shiny_search.cpp source/pla/pla_shiny_search.cpp
+//   ./bench_pla_shiny_search [threads]
+#include "pla/pla_shiny_search.h"
+#include "pla/pla_encounter.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+long long micros(Clock::time_point a, Clock::time_point b) {
+    return (long long)std::chrono::duration_cast<std::chrono::microseconds>(b - a).count();
+}
+
+std::vector<PlaShinySearch::Job> makeJobs(size_t count, int rolls) {
+    std::mt19937_64 rng(42);
+    std::vector<PlaShinySearch::Job> jobs(count);
+    for (PlaShinySearch::Job& j : jobs) j = {rng(), rolls};
+    return jobs;
+}
+
+// Reference walk with full generation: the first `k` shiny advances.
+int scalarFirstK(uint64_t groupSeed, int rolls, uint32_t maxAdvance, int k, uint32_t* out) {
+    Xoroshiro128Plus main(groupSeed);
+    int found = 0;
+    for (uint32_t adv = 0; adv <= maxAdvance && found < k; adv++) {
+        uint64_t gen = main.next();
+        main.next();                        // spawner 1's seed, unused
+        Xoroshiro128Plus spawner(gen);
+        spawner.next();                     // slot roll, unused
+        if (PlaEncounter::generateFromSeed(spawner.next(), rolls, 0).shiny) out[found++] = adv;
+        main = Xoroshiro128Plus(main.next());
+    }
+    return found;
+}
+
+size_t benchFirst(int rolls) {
+    constexpr size_t SEEDS = 3000;
+    constexpr uint32_t DEPTH = 5000;
+    auto jobs = makeJobs(SEEDS, rolls);
+    std::vector<PlaShinySearch::Hits> hits(SEEDS);
+    std::vector<int> ref(SEEDS);
+    PlaShinySearch::Options opt;
+    opt.maxAdvance = DEPTH;
+
+    auto t0 = Clock::now();
+    for (size_t i = 0; i < SEEDS; i++)
+        ref[i] = PlaEncounter::nextShiny(jobs[i].groupSeed, rolls, 0, true, DEPTH);
+    auto t1 = Clock::now();
+    PlaShinySearch::run(jobs.data(), SEEDS, opt, hits.data());
+    auto t2 = Clock::now();
+
+    size_t mismatches = 0;
+    long advances = 0;
+    for (size_t i = 0; i < SEEDS; i++) {
+        int got = hits[i].count ? (int)hits[i].advance[0] : -1;
+        mismatches += got != ref[i];
+        advances += got >= 0 ? got + 1 : DEPTH + 1;
+    }
+    std::printf("first shiny, %zu seeds x %u, %d roll(s): nextShiny %lld us, engine %lld us "
+                "(%.2f ns/advance), %zu mismatches\n", SEEDS, DEPTH, rolls, micros(t0, t1),
+                micros(t1, t2), micros(t1, t2) * 1000.0 / advances, mismatches);
+    return mismatches;
+}
+
+size_t benchDeep(int threads) {
+    constexpr size_t SEEDS = 300;
+    constexpr size_t CHECKED = 20;
+    auto jobs = makeJobs(SEEDS, 1);
+    std::vector<PlaShinySearch::Hits> hits(SEEDS);
+    PlaShinySearch::Options opt;
+    opt.maxAdvance = 1000000;
+    opt.firstK = 3;
+
+    for (int t : {1, threads}) {
+        opt.threads = t;
+        auto t0 = Clock::now();
+        PlaShinySearch::run(jobs.data(), SEEDS, opt, hits.data());
+        auto t1 = Clock::now();
+        std::printf("first %d shinies, %zu seeds x %u, %d thread(s): %lld us\n",
+                    opt.firstK, SEEDS, opt.maxAdvance, t, micros(t0, t1));
+        if (t == threads) break;
+    }
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < CHECKED; i++) {
+        uint32_t ref[PlaShinySearch::MAX_HITS];
+        int found = scalarFirstK(jobs[i].groupSeed, 1, opt.maxAdvance, opt.firstK, ref);
+        if (found != hits[i].count) {
+            mismatches++;
+            continue;
+        }
+        for (int k = 0; k < found; k++) mismatches += ref[k] != hits[i].advance[k];
+    }
+    std::printf("  first %zu seeds vs. full generation: %zu mismatches\n", CHECKED, mismatches);
+    return mismatches;
+}
+
+// The engine's per-advance work (advanceGroup + the EC/TID/PID shiny check),
+// copied here because the engine keeps it internal.
+inline uint64_t advanceGroup(uint64_t& group) {
+    Xoroshiro128Plus main(group);
+    uint64_t gen = main.next();
+    main.next();                        // spawner 1's seed, unused
+    group = main.next();                // reseed: (r, CONST)
+    Xoroshiro128Plus spawner(gen);
+    spawner.next();                     // slot roll, unused
+    return spawner.next();
+}
+
+constexpr uint32_t REJECT = 0xFFFFFFFFu;
+volatile long sink;                 // keeps the lane walks from being optimised out
+
+inline int fastShiny(uint64_t fixedSeed, int rolls) {
+    Xoroshiro128Plus rng(fixedSeed);
+    uint32_t ec = (uint32_t)rng.next();
+    uint32_t sidtid = (uint32_t)rng.next();
+    if (ec == REJECT || sidtid == REJECT) return -1;
+    uint32_t tsv = (sidtid >> 16) ^ (sidtid & 0xFFFF);
+    for (int i = 0; i < rolls; i++) {
+        uint32_t pid = (uint32_t)rng.next();
+        if (pid == REJECT) return -1;
+        if (((pid >> 16) ^ (pid & 0xFFFF) ^ tsv) < 0x10) return 1;
+    }
+    return 0;
+}
+
+template <int LANES>
+__attribute__((noinline)) long walkLanes(long steps, int rolls) {
+    uint64_t group[LANES];
+    for (int l = 0; l < LANES; l++) group[l] = (l + 1) * 0x9E3779B97F4A7C15ull;
+    long hits = 0;
+    for (long i = 0; i < steps; i++)
+        for (int l = 0; l < LANES; l++) hits += fastShiny(advanceGroup(group[l]), rolls);
+    return hits;
+}
+
+// Best of REPS runs, the lane counts taken in turn so clock ramp-up and
+// noisy neighbours hit them alike.
+template <int LANES>
+double lanesNs(long advances) {
+    auto t0 = Clock::now();
+    long hits = walkLanes<LANES>(advances / LANES, 1);
+    auto t1 = Clock::now();
+    sink = hits;
+    return micros(t0, t1) * 1000.0 / advances;
+}
+
+void benchLanes(long advances) {
+    constexpr int REPS = 5;
+    double best[3] = {1e9, 1e9, 1e9};
+    for (int rep = 0; rep < REPS; rep++) {
+        best[0] = std::min(best[0], lanesNs<1>(advances));
+        best[1] = std::min(best[1], lanesNs<4>(advances));
+        best[2] = std::min(best[2], lanesNs<8>(advances));
+    }
+    std::printf("  1 lane %.2f, 4 lanes %.2f, 8 lanes %.2f ns/advance (best of %d)\n",
+                best[0], best[1], best[2], REPS);
+}
+
+} // anonymous
+
+int main(int argc, char** argv) {
+    int threads = argc > 1 ? std::max(1, std::atoi(argv[1])) : 4;
+    size_t mismatches = benchFirst(1) + benchFirst(3) + benchDeep(threads);
+
+    std::printf("lockstep walk, 8M advances:\n");
+    benchLanes(8000000);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -3,6 +3,7 @@
 Fetch PLA spawner marker + slot JSONs from Lincoln-LM's repos and emit
 include/pla/pla_markers.h with:
   - per-region constexpr Marker arrays (group_id, coords, ivs, slot range)
+  - per-region dense group_id -> marker index tables for O(1) lookups
   - a flat SLOTS[] array of (species_name, weight, alpha) entries
 
 Usage:
@@ -81,6 +82,23 @@ def pick_time_weather(tw_map):
 def escape(s):
     return s.replace("\\", "\\\\").replace('"', '\\"')
 
+def emit_group_index(cpp_name, group_ids):
+    """Dense group_id -> marker index table (-1 = no marker for that group)."""
+    table = [-1] * (max(group_ids) + 1 if group_ids else 0)
+    for idx, gid in enumerate(group_ids):
+        if 0 <= gid < len(table) and table[gid] < 0:
+            table[gid] = idx
+    lines = [
+        f"// group_id -> index into {cpp_name}, -1 if the region has no marker for it.",
+        f"inline constexpr int16_t {cpp_name}_BY_GROUP[] = {{",
+    ]
+    for i in range(0, len(table), 16):
+        lines.append("    " + ", ".join(str(v) for v in table[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append(f"inline constexpr size_t {cpp_name}_BY_GROUP_COUNT = {len(table)};")
+    lines.append("")
+    return lines
+
 def main():
     parts = [
         "#pragma once",
@@ -89,6 +107,7 @@ def main():
         "//   markers: Lincoln-LM/JS-Finder Resources/pla_spawners/jsons/*.json",
         "//   slots:   Lincoln-LM/PLA-Live-Map static/resources/*.json",
         '#include "pla/pla_region.h"',
+        "#include <algorithm>",
         "#include <cstdint>",
         "#include <cstddef>",
         "",
@@ -119,6 +138,7 @@ def main():
     unresolved = set()
 
     flat_slots = []
+    slot_cumulative = []   # running weight within each marker's run of SLOTS
     region_marker_blocks = []
     bounds_lines = []
 
@@ -128,8 +148,10 @@ def main():
         slot_tables = fetch(f"{SLOTS_BASE}/{json_name}.json")
 
         marker_lines = []
+        group_ids = []
         for _, m in sorted(markers.items(), key=lambda kv: int(kv[0])):
             gid = int(m.get("groupID", 0))
+            group_ids.append(gid)
             coords = m.get("coords", [0.0, 0.0, 0.0])
             x, y, z = float(coords[0]), float(coords[1]), float(coords[2])
             ivs = int(m.get("ivs", 0))
@@ -165,6 +187,7 @@ def main():
                 # Display the clean species name (sprite already encodes the form).
                 flat_slots.append((base_name, w, sid, form, alpha))
                 slot_total += w
+                slot_cumulative.append(slot_total)
                 slot_count += 1
             if slot_count > 255: slot_count = 255
 
@@ -173,7 +196,7 @@ def main():
                 f"{slot_offset}, {slot_count}, {slot_total} }},"
             )
 
-        region_marker_blocks.append((cpp_name, marker_lines))
+        region_marker_blocks.append((cpp_name, marker_lines, group_ids))
 
         w, h = MAP_DIMS[json_name]
         bounds_lines.append(
@@ -189,13 +212,23 @@ def main():
     parts.append(f"inline constexpr size_t SLOTS_COUNT = {len(flat_slots)};")
     parts.append("")
 
+    # Emit SLOT_CUMULATIVE[] (parallel to SLOTS)
+    parts.append("// SLOT_CUMULATIVE[m.slotOffset + i]: total weight of the marker's slots 0..i,")
+    parts.append("// so the last entry of each run equals m.slotTotal.")
+    parts.append("inline constexpr uint16_t SLOT_CUMULATIVE[] = {")
+    for i in range(0, len(slot_cumulative), 16):
+        parts.append("    " + ", ".join(str(c) for c in slot_cumulative[i:i + 16]) + ",")
+    parts.append("};")
+    parts.append("")
+
     # Emit per-region marker arrays
-    for cpp_name, lines in region_marker_blocks:
+    for cpp_name, lines, group_ids in region_marker_blocks:
         parts.append(f"inline constexpr Marker {cpp_name}[] = {{")
         parts.extend(lines)
         parts.append("};")
         parts.append(f"inline constexpr size_t {cpp_name}_COUNT = {len(lines)};")
         parts.append("")
+        parts.extend(emit_group_index(cpp_name, group_ids))
 
     parts.append("inline constexpr RegionBounds BOUNDS[5] = {")
     parts.extend(bounds_lines)
@@ -214,29 +247,59 @@ def main():
         "    }\n"
         "}\n"
     )
+    parts.append(
+        "inline const int16_t* getGroupIndex(PlaRegion r, size_t& count) {\n"
+        "    switch (r) {\n"
+        "        case PlaRegion::ObsidianFieldlands: count = OBSIDIAN_FIELDLANDS_BY_GROUP_COUNT; return OBSIDIAN_FIELDLANDS_BY_GROUP;\n"
+        "        case PlaRegion::CrimsonMirelands:   count = CRIMSON_MIRELANDS_BY_GROUP_COUNT;   return CRIMSON_MIRELANDS_BY_GROUP;\n"
+        "        case PlaRegion::CobaltCoastlands:   count = COBALT_COASTLANDS_BY_GROUP_COUNT;   return COBALT_COASTLANDS_BY_GROUP;\n"
+        "        case PlaRegion::CoronetHighlands:   count = CORONET_HIGHLANDS_BY_GROUP_COUNT;   return CORONET_HIGHLANDS_BY_GROUP;\n"
+        "        case PlaRegion::AlabasterIcelands:  count = ALABASTER_ICELANDS_BY_GROUP_COUNT;  return ALABASTER_ICELANDS_BY_GROUP;\n"
+        "        default: count = 0; return nullptr;\n"
+        "    }\n"
+        "}\n"
+    )
+    parts.append(
+        "// O(1): the marker for `groupId` in region `r`, or nullptr if it has none.\n"
+        "inline const Marker* markerFor(PlaRegion r, int groupId) {\n"
+        "    size_t n, count;\n"
+        "    const int16_t* index = getGroupIndex(r, count);\n"
+        "    if (groupId < 0 || (size_t)groupId >= count || index[groupId] < 0) return nullptr;\n"
+        "    const Marker* ms = getMarkers(r, n);\n"
+        "    return &ms[index[groupId]];\n"
+        "}\n"
+    )
     parts.append(
         "inline int findMarker(int groupId, const Marker*& outMarker) {\n"
         "    for (int r = 0; r < (int)PlaRegion::Count; r++) {\n"
-        "        size_t n; const Marker* ms = getMarkers((PlaRegion)r, n);\n"
-        "        for (size_t i = 0; i < n; i++) {\n"
-        "            if (ms[i].groupId == groupId) { outMarker = &ms[i]; return r; }\n"
-        "        }\n"
+        "        outMarker = markerFor((PlaRegion)r, groupId);\n"
+        "        if (outMarker) return r;\n"
         "    }\n"
-        "    outMarker = nullptr;\n"
         "    return -1;\n"
         "}\n"
     )
 
+    parts.append(
+        "// Resolve a raw 64-bit slot roll to a SlotEntry for this marker. The game's\n"
+        "// roll is slotRaw / 2^64 * slotTotal; floor(slotRaw * slotTotal / 2^64) is\n"
+        "// below an integer cumulative weight exactly when that real-valued roll is,\n"
+        "// so the slot is the first cumulative weight above it.\n"
+        "inline const SlotEntry* resolveSlotRaw(const Marker& m, uint64_t slotRaw) {\n"
+        "    if (m.slotCount == 0 || m.slotTotal == 0) return nullptr;\n"
+        "    uint32_t roll = (uint32_t)(((unsigned __int128)slotRaw * m.slotTotal) >> 64);\n"
+        "    const uint16_t* cum = &SLOT_CUMULATIVE[m.slotOffset];\n"
+        "    size_t i = std::upper_bound(cum, cum + m.slotCount, roll) - cum;\n"
+        "    return &SLOTS[m.slotOffset + std::min<size_t>(i, m.slotCount - 1)];\n"
+        "}\n"
+    )
     parts.append(
         "// Resolve a slot roll [0, slotTotal) to a SlotEntry for this marker.\n"
         "inline const SlotEntry* resolveSlot(const Marker& m, double slotRoll) {\n"
         "    if (m.slotCount == 0 || m.slotTotal == 0) return nullptr;\n"
-        "    double acc = 0;\n"
-        "    for (uint8_t i = 0; i < m.slotCount; i++) {\n"
-        "        acc += SLOTS[m.slotOffset + i].weight;\n"
-        "        if (slotRoll < acc) return &SLOTS[m.slotOffset + i];\n"
-        "    }\n"
-        "    return &SLOTS[m.slotOffset + m.slotCount - 1];\n"
+        "    const uint16_t* cum = &SLOT_CUMULATIVE[m.slotOffset];\n"
+        "    size_t i = std::upper_bound(cum, cum + m.slotCount, slotRoll,\n"
+        "                                [](double r, uint16_t c) { return r < c; }) - cum;\n"
+        "    return &SLOTS[m.slotOffset + std::min<size_t>(i, m.slotCount - 1)];\n"
         "}\n"
     )
 
@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""
+Emit include/species_names.h: national dex species names from
+romfs/data/species_en.txt, for code without romfs text data (the overlay).
+
+Usage:
+    python3 tools/convert_species_names.py
+"""
+
+import os
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+PROJECT_DIR = os.path.dirname(SCRIPT_DIR)
+SPECIES_FILE = os.path.join(PROJECT_DIR, "romfs", "data", "species_en.txt")
+OUT_FILE = os.path.join(PROJECT_DIR, "include", "species_names.h")
+
+def escape(s):
+    return s.replace("\\", "\\\\").replace('"', '\\"')
+
+def main():
+    # species_en.txt is 0-indexed: line 1 = Egg (id 0), line 2 = Bulbasaur (id 1), ...
+    with open(SPECIES_FILE, encoding="utf-8") as f:
+        names = [line.rstrip("\n").rstrip("\r") for line in f]
+    while names and not names[-1]:
+        names.pop()
+
+    parts = [
+        "#pragma once",
+        "// Auto-generated by tools/convert_species_names.py — do not edit manually.",
+        "// Source: romfs/data/species_en.txt",
+        "#include <cstddef>",
+        "#include <cstdint>",
+        "",
+        "namespace SpeciesNames {",
+        "",
+        "// NAMES[id]: national dex id -> English name (0 = Egg).",
+        "inline constexpr const char* NAMES[] = {",
+    ]
+    for i in range(0, len(names), 8):
+        parts.append("    " + " ".join(f'"{escape(n)}",' for n in names[i:i + 8]))
+    parts.append("};")
+    parts.append(f"inline constexpr size_t COUNT = {len(names)};")
+    parts.append("")
+    parts.append(
+        "inline const char* name(uint16_t id) {\n"
+        "    return (id > 0 && id < COUNT) ? NAMES[id] : \"?\";\n"
+        "}\n"
+    )
+    parts.append("} // namespace SpeciesNames")
+    parts.append("")
+
+    with open(OUT_FILE, "w", encoding="utf-8") as f:
+        f.write("\n".join(parts))
+    print(f"wrote {OUT_FILE} ({len(names)} names)")
+
+if __name__ == "__main__":
+    sys.exit(main() or 0)
@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+"""
+Emit include/sv/sv_raid_tables.h: the SV raid data the overlay's trimmed raid
+core (SvRaidCore) needs, compiled in instead of loaded from romfs.
+
+Built from the app's own romfs/data files:
+  - encounter_gem_{paldea,kitakami,blueberry}_{standard,black}.pkl
+    -> ENCOUNTERS[] with only the fields encounter selection, tera type and
+       shiny state use, in file order (first match wins, as in the app)
+  - personal_sv
+    -> each encounter's type1/type2 baked in, so the 112 KB personal table
+       is not needed at runtime
+  - reward_fixed.bin / reward_lottery.bin
+    -> only the tables those encounters reference; hashes become indices
+  - species_en.txt / types_en.txt / items_en.txt
+    -> names for the referenced species, tera types and reward items
+
+Usage:
+    python3 tools/convert_sv_raid_tables.py
+"""
+
+import os
+import struct
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+PROJECT_DIR = os.path.dirname(SCRIPT_DIR)
+DATA_DIR = os.path.join(PROJECT_DIR, "romfs", "data")
+OUT_FILE = os.path.join(PROJECT_DIR, "include", "sv", "sv_raid_tables.h")
+
+MAPS = ["paldea", "kitakami", "blueberry"]   # TeraRaidMapParent order
+ENCOUNTER_SIZE = 0x3C                        # EncounterTeraTF9::SERIALIZED_SIZE
+PERSONAL_SIZE = 0x50                         # PersonalTable::ENTRY_SIZE
+
+def read(name):
+    with open(os.path.join(DATA_DIR, name), "rb") as f:
+        return f.read()
+
+def read_lines(name):
+    with open(os.path.join(DATA_DIR, name), encoding="utf-8") as f:
+        return [line.rstrip("\n").rstrip("\r") for line in f]
+
+def escape(s):
+    return s.replace("\\", "\\\\").replace('"', '\\"')
+
+def personal_types(personal, species, form):
+    """type1/type2 for (species, form): PersonalTable::getFormEntry."""
+    count = len(personal) // PERSONAL_SIZE
+    def entry(i):
+        return personal[i * PERSONAL_SIZE:(i + 1) * PERSONAL_SIZE]
+    idx = species if species < count else 0
+    if form != 0 and species < count:
+        e = entry(species)
+        form_count = e[0x1A]
+        fsi = e[0x18] | (e[0x19] << 8)
+        if form < form_count and fsi != 0 and fsi + form - 1 < count:
+            idx = fsi + form - 1
+    e = entry(idx)
+    return e[0x06], e[0x07]
+
+def load_fixed():
+    """{hash: [item ids]} - category-resolved entries (id 0) are dropped."""
+    data = read("reward_fixed.bin")
+    tables, pos = {}, 2
+    for _ in range(struct.unpack_from("<H", data, 0)[0]):
+        h, count = struct.unpack_from("<QB", data, pos); pos += 9
+        items = []
+        for _ in range(count):
+            _, item_id, _, _ = struct.unpack_from("<BHBb", data, pos); pos += 5
+            if item_id:
+                items.append(item_id)
+        tables[h] = items
+    return tables
+
+def load_lottery():
+    """{hash: (totalRate, [(item id, rate)])}."""
+    data = read("reward_lottery.bin")
+    tables, pos = {}, 2
+    for _ in range(struct.unpack_from("<H", data, 0)[0]):
+        h, total, count = struct.unpack_from("<QHB", data, pos); pos += 11
+        items = []
+        for _ in range(count):
+            _, item_id, _, rate = struct.unpack_from("<BHBH", data, pos); pos += 6
+            items.append((item_id, rate))
+        tables[h] = (total, items)
+    return tables
+
+def main():
+    personal = read("personal_sv")
+    species_names = read_lines("species_en.txt")
+    type_names = read_lines("types_en.txt")[:18]
+    item_names = read_lines("items_en.txt")
+    fixed_all = load_fixed()
+    lottery_all = load_lottery()
+
+    encounters = []          # emitted rows
+    ranges = []              # [map][black] -> (offset, count)
+    fixed_index, lottery_index = {}, {}
+    fixed_tables, lottery_tables = [], []
+    missing = set()
+
+    for m in MAPS:
+        row = []
+        for kind in ("standard", "black"):
+            data = read(f"encounter_gem_{m}_{kind}.pkl")
+            offset = len(encounters)
+            for i in range(len(data) // ENCOUNTER_SIZE):
+                p = data[i * ENCOUNTER_SIZE:(i + 1) * ENCOUNTER_SIZE]
+                species, form = struct.unpack_from("<HB", p, 0)
+                shiny, gem, stars, rand_rate = p[0x06], p[0x10], p[0x12], p[0x13]
+                min_s, min_v = struct.unpack_from("<hh", p, 0x14)
+                fixed_hash, lottery_hash = struct.unpack_from("<QQ", p, 0x1C)
+                type1, type2 = personal_types(personal, species, form)
+
+                fixed = -1
+                if fixed_hash in fixed_all:
+                    if fixed_hash not in fixed_index:
+                        fixed_index[fixed_hash] = len(fixed_tables)
+                        fixed_tables.append(fixed_all[fixed_hash])
+                    fixed = fixed_index[fixed_hash]
+                elif fixed_hash:
+                    missing.add(("fixed", fixed_hash))
+                lottery = -1
+                if lottery_hash in lottery_all:
+                    if lottery_hash not in lottery_index:
+                        lottery_index[lottery_hash] = len(lottery_tables)
+                        lottery_tables.append(lottery_all[lottery_hash])
+                    lottery = lottery_index[lottery_hash]
+                elif lottery_hash:
+                    missing.add(("lottery", lottery_hash))
+
+                name = species_names[species] if species < len(species_names) else "?"
+                encounters.append((name, species, form, stars, rand_rate, shiny, gem,
+                                   type1, type2, min_s, min_v, fixed, lottery))
+            row.append((offset, len(encounters) - offset))
+        ranges.append(row)
+
+    fixed_items, fixed_ranges = [], []
+    for items in fixed_tables:
+        fixed_ranges.append((len(fixed_items), len(items)))
+        fixed_items.extend(items)
+    lottery_items, lottery_ranges = [], []
+    for total, items in lottery_tables:
+        lottery_ranges.append((total, len(lottery_items), len(items)))
+        lottery_items.extend(items)
+
+    reward_ids = sorted(set(fixed_items) | {i for i, _ in lottery_items if i})
+
+    parts = [
+        "#pragma once",
+        "// Auto-generated by tools/convert_sv_raid_tables.py — do not edit manually.",
+        "// Source: romfs/data encounter_gem_*.pkl, personal_sv, reward_*.bin and the",
+        "// species/types/items name lists.",
+        "#include <algorithm>",
+        "#include <cstddef>",
+        "#include <cstdint>",
+        "",
+        "namespace SvRaidTables {",
+        "",
+        "// One EncounterTeraTF9, trimmed to what SvRaidCore reads.",
+        "struct Encounter {",
+        "    const char* name;",
+        "    uint16_t species;",
+        "    uint8_t  form;",
+        "    uint8_t  stars;",
+        "    uint8_t  randRate;",
+        "    uint8_t  shiny;          // ShinyType",
+        "    uint8_t  gem;            // GemType",
+        "    uint8_t  type1, type2;   // personal types, for GemType::Default",
+        "    int16_t  randRateMinScarlet;",
+        "    int16_t  randRateMinViolet;",
+        "    int16_t  fixedTable;     // index into FIXED_TABLES, -1 = none",
+        "    int16_t  lotteryTable;   // index into LOTTERY_TABLES, -1 = none",
+        "};",
+        "",
+        "struct Range { uint16_t offset, count; };",
+        "",
+        "// Lottery rolls walk the items by rate; itemId 0 is a tera shard or",
+        "// material, resolved from the raid in the app.",
+        "struct LotteryTable { uint16_t totalRate, offset, count; };",
+        "struct LotteryItem  { uint16_t itemId, rate; };",
+        "",
+        "struct ItemName { uint16_t id; const char* name; };",
+        "",
+        "inline constexpr Encounter ENCOUNTERS[] = {",
+    ]
+    for (name, species, form, stars, rand_rate, shiny, gem, t1, t2,
+         min_s, min_v, fixed, lottery) in encounters:
+        parts.append(f'    {{ "{escape(name)}", {species}, {form}, {stars}, {rand_rate}, '
+                     f'{shiny}, {gem}, {t1}, {t2}, {min_s}, {min_v}, {fixed}, {lottery} }},')
+    parts.append("};")
+    parts.append("")
+
+    parts.append("// TABLES[map][black]: the map's standard and black encounter runs.")
+    parts.append("inline constexpr Range TABLES[3][2] = {")
+    for (so, sc), (bo, bc) in ranges:
+        parts.append(f"    {{ {{ {so}, {sc} }}, {{ {bo}, {bc} }} }},")
+    parts.append("};")
+    parts.append("")
+
+    parts.append("// Fixed rewards: item ids only (category-resolved entries are dropped).")
+    parts.append("inline constexpr Range FIXED_TABLES[] = {")
+    for off, cnt in fixed_ranges:
+        parts.append(f"    {{ {off}, {cnt} }},")
+    parts.append("};")
+    parts.append("inline constexpr uint16_t FIXED_ITEMS[] = {")
+    for i in range(0, len(fixed_items), 16):
+        parts.append("    " + ", ".join(str(v) for v in fixed_items[i:i + 16]) + ",")
+    parts.append("};")
+    parts.append("")
+
+    parts.append("inline constexpr LotteryTable LOTTERY_TABLES[] = {")
+    for total, off, cnt in lottery_ranges:
+        parts.append(f"    {{ {total}, {off}, {cnt} }},")
+    parts.append("};")
+    parts.append("inline constexpr LotteryItem LOTTERY_ITEMS[] = {")
+    for i in range(0, len(lottery_items), 8):
+        parts.append("    " + ", ".join(f"{{ {a}, {r} }}" for a, r in lottery_items[i:i + 8]) + ",")
+    parts.append("};")
+    parts.append("")
+
+    parts.append("inline constexpr const char* TYPE_NAMES[18] = {")
+    parts.append("    " + ", ".join(f'"{escape(t)}"' for t in type_names) + ",")
+    parts.append("};")
+    parts.append("")
+
+    parts.append("// Sorted by id.")
+    parts.append("inline constexpr ItemName ITEM_NAMES[] = {")
+    for i in reward_ids:
+        name = item_names[i] if i < len(item_names) else "?"
+        parts.append(f'    {{ {i}, "{escape(name)}" }},')
+    parts.append("};")
+    parts.append("")
+
+    parts.append(
+        "inline const char* itemName(uint16_t id) {\n"
+        "    const ItemName* end = ITEM_NAMES + sizeof(ITEM_NAMES) / sizeof(ITEM_NAMES[0]);\n"
+        "    const ItemName* it = std::lower_bound(ITEM_NAMES, end, id,\n"
+        "        [](const ItemName& e, uint16_t v) { return e.id < v; });\n"
+        "    return (it != end && it->id == id) ? it->name : \"?\";\n"
+        "}\n"
+    )
+    parts.append("} // namespace SvRaidTables")
+    parts.append("")
+
+    os.makedirs(os.path.dirname(OUT_FILE), exist_ok=True)
+    with open(OUT_FILE, "w", encoding="utf-8") as f:
+        f.write("\n".join(parts))
+    print(f"wrote {OUT_FILE} ({len(encounters)} encounters, "
+          f"{len(fixed_tables)} fixed + {len(lottery_tables)} lottery tables, "
+          f"{len(reward_ids)} item names)")
+    if missing:
+        print(f"reward hashes with no table ({len(missing)})")
+
+if __name__ == "__main__":
+    sys.exit(main() or 0)
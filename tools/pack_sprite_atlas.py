@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+"""
+Pack tools/sprites/NNN[-F].png into a few large sheets plus a binary index,
+so the app draws every list/detail sprite from a handful of textures instead
+of decoding ~1,200 PNGs into one texture each.
+
+Usage:
+    python3 tools/pack_sprite_atlas.py
+
+Output (romfs/atlas/):
+    sprites_0.png, sprites_1.png, ...   RGBA sheets, at most SHEET_SIZE square
+    sprites.bin                          index, little-endian:
+        u32 magic 'SPAT'
+        u16 version (1)
+        u16 sheetCount
+        u32 entryCount
+        entryCount x {u16 species, u8 form, u8 sheet, u16 x, u16 y, u16 w, u16 h}
+    Entries are sorted by (species, form) so the app can binary search.
+
+Only the Python standard library is used (sprites are 8-bit RGBA PNGs).
+"""
+
+import os
+import re
+import struct
+import sys
+import zlib
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+PROJECT_DIR = os.path.dirname(SCRIPT_DIR)
+SPRITE_DIR = os.path.join(SCRIPT_DIR, "sprites")  # packer input; not shipped in romfs
+OUT_DIR = os.path.join(PROJECT_DIR, "romfs", "atlas")
+
+SHEET_SIZE = 1024
+PADDING = 1  # transparent gutter so linear filtering never bleeds neighbours
+MAGIC = 0x54415053  # 'SPAT'
+VERSION = 1
+
+NAME_RE = re.compile(r"^(\d{3,4})(?:-(\d+))?\.png$")
+PNG_SIG = b"\x89PNG\r\n\x1a\n"
+
+
+# --- Minimal PNG codec (8-bit RGBA, non-interlaced) ---
+
+def read_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != PNG_SIG:
+        raise ValueError(f"{path}: not a PNG")
+    pos = 8
+    width = height = 0
+    idat = []
+    while pos < len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+            if depth != 8 or color != 6 or interlace != 0:
+                raise ValueError(f"{path}: expected 8-bit RGBA non-interlaced")
+        elif ctype == b"IDAT":
+            idat.append(body)
+        elif ctype == b"IEND":
+            break
+
+    raw = zlib.decompress(b"".join(idat))
+    stride = width * 4
+    rows = []
+    prev = bytearray(stride)
+    p = 0
+    for _ in range(height):
+        ftype = raw[p]
+        line = bytearray(raw[p + 1:p + 1 + stride])
+        p += 1 + stride
+        if ftype == 1:
+            for i in range(4, stride):
+                line[i] = (line[i] + line[i - 4]) & 0xFF
+        elif ftype == 2:
+            for i in range(stride):
+                line[i] = (line[i] + prev[i]) & 0xFF
+        elif ftype == 3:
+            for i in range(stride):
+                left = line[i - 4] if i >= 4 else 0
+                line[i] = (line[i] + ((left + prev[i]) >> 1)) & 0xFF
+        elif ftype == 4:
+            for i in range(stride):
+                a = line[i - 4] if i >= 4 else 0
+                b = prev[i]
+                c = prev[i - 4] if i >= 4 else 0
+                pa, pb, pc = abs(b - c), abs(a - c), abs(a + b - 2 * c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        elif ftype != 0:
+            raise ValueError(f"{path}: bad filter {ftype}")
+        rows.append(bytes(line))
+        prev = line
+    return width, height, rows
+
+
+def write_png(path, width, height, pixels):
+    def chunk(ctype, body):
+        crc = zlib.crc32(ctype + body) & 0xFFFFFFFF
+        return struct.pack(">I", len(body)) + ctype + body + struct.pack(">I", crc)
+
+    stride = width * 4
+    raw = bytearray()
+    for y in range(height):
+        raw.append(0)
+        raw += pixels[y * stride:(y + 1) * stride]
+    ihdr = struct.pack(">IIBBBBB", width, height, 8, 6, 0, 0, 0)
+    with open(path, "wb") as f:
+        f.write(PNG_SIG)
+        f.write(chunk(b"IHDR", ihdr))
+        f.write(chunk(b"IDAT", zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+# --- Shelf packer ---
+
+def pack(sprites):
+    """Assign (sheet, x, y) to each sprite; tallest first, left-to-right shelves."""
+    order = sorted(sprites, key=lambda s: (-s["h"], -s["w"]))
+    sheets = []  # per sheet: [shelfY, shelfH, cursorX, usedW, usedH]
+    for s in order:
+        w, h = s["w"] + PADDING, s["h"] + PADDING
+        placed = False
+        for idx, sh in enumerate(sheets):
+            if sh[2] + w > SHEET_SIZE:
+                # open a new shelf below the current one
+                if sh[0] + sh[1] + h > SHEET_SIZE:
+                    continue
+                sh[0] += sh[1]
+                sh[1] = 0
+                sh[2] = 0
+            if sh[0] + h > SHEET_SIZE:
+                continue
+            s["sheet"], s["x"], s["y"] = idx, sh[2], sh[0]
+            sh[2] += w
+            sh[1] = max(sh[1], h)
+            sh[3] = max(sh[3], sh[2])
+            sh[4] = max(sh[4], sh[0] + sh[1])
+            placed = True
+            break
+        if not placed:
+            sheets.append([0, h, w, w, h])
+            s["sheet"], s["x"], s["y"] = len(sheets) - 1, 0, 0
+    return [(sh[3], sh[4]) for sh in sheets]
+
+
+def main():
+    sprites = []
+    for name in sorted(os.listdir(SPRITE_DIR)):
+        m = NAME_RE.match(name)
+        if not m:
+            continue
+        species = int(m.group(1))
+        form = int(m.group(2) or 0)
+        if species > 0xFFFF or form > 0xFF:
+            print(f"  skipping {name}: id out of range", file=sys.stderr)
+            continue
+        w, h, rows = read_png(os.path.join(SPRITE_DIR, name))
+        sprites.append({"species": species, "form": form, "w": w, "h": h, "rows": rows})
+
+    if not sprites:
+        print(f"No sprites found in {SPRITE_DIR}", file=sys.stderr)
+        sys.exit(1)
+
+    sheet_dims = pack(sprites)
+    os.makedirs(OUT_DIR, exist_ok=True)
+
+    for idx, (sw, sh) in enumerate(sheet_dims):
+        pixels = bytearray(sw * sh * 4)
+        for s in sprites:
+            if s["sheet"] != idx:
+                continue
+            for row, line in enumerate(s["rows"]):
+                off = ((s["y"] + row) * sw + s["x"]) * 4
+                pixels[off:off + len(line)] = line
+        out = os.path.join(OUT_DIR, f"sprites_{idx}.png")
+        write_png(out, sw, sh, pixels)
+        print(f"  {out}: {sw}x{sh}")
+
+    sprites.sort(key=lambda s: (s["species"], s["form"]))
+    index = struct.pack("<IHHI", MAGIC, VERSION, len(sheet_dims), len(sprites))
+    for s in sprites:
+        index += struct.pack("<HBBHHHH", s["species"], s["form"], s["sheet"],
+                             s["x"], s["y"], s["w"], s["h"])
+    out = os.path.join(OUT_DIR, "sprites.bin")
+    with open(out, "wb") as f:
+        f.write(index)
+    print(f"  {out}: {len(sprites)} sprites in {len(sheet_dims)} sheet(s)")
+
+
+if __name__ == "__main__":
+    main()